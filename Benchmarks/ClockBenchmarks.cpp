@@ -0,0 +1,63 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include <cstdio>
+#include <ctime>
+#include <string>
+
+#include <ISCLogs/ISCLogs.hpp>
+
+#include "Support.hpp"
+
+namespace
+{
+// Arguments are {source}, numbered like isc::Clock::Source.
+void BM_ClockNow(benchmark::State& state)
+{
+    const isc::Clock::Source previous = isc::Clock::source();
+    isc::Clock::set_source(static_cast<isc::Clock::Source>(state.range(0)));
+    if (isc::Clock::source() != static_cast<isc::Clock::Source>(state.range(0)))
+        state.SetLabel("fell back");
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(isc::Clock::now());
+
+    isc::Clock::set_source(previous);
+}
+BENCHMARK(BM_ClockNow)->ArgName("source")->DenseRange(0, 3);
+
+void BM_FormatTimestamp(benchmark::State& state)
+{
+    const isc::util::TimestampFormatter formatter;
+    std::uint64_t timestamp = isc::Clock::now();
+    char buffer[isc::util::TimestampFormatter::max_size];
+
+    // Consecutive lines are usually within the same minute, so the prefix is reused.
+    for (auto _ : state)
+    {
+        timestamp += 1'000'000;
+        benchmark::DoNotOptimize(formatter.format(timestamp, buffer));
+    }
+}
+BENCHMARK(BM_FormatTimestamp);
+
+// What a logger formatting its own timestamps with the C library pays for every line.
+void BM_FormatTimestampStrftime(benchmark::State& state)
+{
+    std::uint64_t timestamp = isc::Clock::now();
+    char buffer[64];
+
+    for (auto _ : state)
+    {
+        timestamp += 1'000'000;
+        const auto seconds = static_cast<std::time_t>(timestamp / 1'000'000'000);
+        std::tm time{};
+        gmtime_r(&seconds, &time);
+        const std::size_t size = std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S", &time);
+        benchmark::DoNotOptimize(std::snprintf(buffer + size, sizeof(buffer) - size, ".%09lluZ",
+                                               static_cast<unsigned long long>(timestamp % 1'000'000'000)));
+    }
+}
+BENCHMARK(BM_FormatTimestampStrftime);
+}
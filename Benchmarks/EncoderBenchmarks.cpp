@@ -0,0 +1,115 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include <string>
+
+#include <ISCLogs/ISCLogs.hpp>
+
+#include "Support.hpp"
+
+namespace
+{
+// Typical log text needs no escaping at all, or only an occasional quote or newline.
+const std::string s_clean_text   = "GET /api/v2/users/8472/preferences responded 200 after 3 attempts in 41.7ms, "
+                                   "served from the regional cache with a stale-while-revalidate window of 30s.";
+const std::string s_escaped_text = "Parsing \"config.json\" failed:\n\tunexpected token at line 4, column 18\n\tin C:\\Program Files\\App\\config.json";
+
+const std::string& text_for(const benchmark::State& state)
+{
+    return state.range(0) == 0 ? s_clean_text : s_escaped_text;
+}
+
+// Escaping one character at a time, to compare the chunked scan against.
+void append_json_string_bytewise(const std::string_view string, std::string& out)
+{
+    out += '"';
+    for (const char character : string)
+    {
+        switch (character)
+        {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        case '\n':
+            out += "\\n";
+            break;
+        case '\t':
+            out += "\\t";
+            break;
+        default:
+            out += character;
+            break;
+        }
+    }
+    out += '"';
+}
+
+void BM_EscapeJson(benchmark::State& state)
+{
+    const std::string& text = text_for(state);
+    std::string out;
+
+    for (auto _ : state)
+    {
+        out.clear();
+        isc::util::append_json_string(text, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * text.size()));
+}
+BENCHMARK(BM_EscapeJson)->ArgName("escaped")->DenseRange(0, 1);
+
+void BM_EscapeJsonBytewise(benchmark::State& state)
+{
+    const std::string& text = text_for(state);
+    std::string out;
+
+    for (auto _ : state)
+    {
+        out.clear();
+        append_json_string_bytewise(text, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * text.size()));
+}
+BENCHMARK(BM_EscapeJsonBytewise)->ArgName("escaped")->DenseRange(0, 1);
+
+isc::ErrorMessage make_message(const benchmark::State& state)
+{
+    isc::ErrorMessage message(504, "Gateway Timeout", text_for(state));
+    message.add_field("request_id", "6f1c2a9e-3b7d-4e55-9a0c-1d2e3f4a5b6c")
+           .add_field("latency_ms", 41.7)
+           .add_field("attempts", 3)
+           .add_field("cached", true)
+           .add_trace("while handling a request");
+    return message;
+}
+
+// Arguments are {escaped, encoding}, with encodings numbered like isc::Encoding.
+void BM_EncodeMessage(benchmark::State& state)
+{
+    const isc::ErrorMessage message = make_message(state);
+    const auto encoding             = static_cast<isc::Encoding>(state.range(1));
+    std::string out;
+    isc::bench::LatencyRecorder latency;
+    const isc::bench::AllocationCounter allocations;
+
+    for (auto _ : state)
+    {
+        const isc::bench::ScopedLatency scope(latency);
+        out.clear();
+        isc::Encoder::encode(encoding, message, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    allocations.report(state);
+    latency.report(state);
+}
+BENCHMARK(BM_EncodeMessage)->ArgNames({"escaped", "encoding"})->ArgsProduct({{0, 1}, {0, 1, 2}});
+}
@@ -0,0 +1,307 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <ISCLogs/ISCLogs.hpp>
+
+#include "Support.hpp"
+
+namespace
+{
+/**
+ * A logger that discards every message, so that only the cost of getting a message to a sink is measured.
+ */
+class NullLogger
+        : public isc::Logger
+{
+public:
+    explicit NullLogger(const isc::Message::Severity threshold) noexcept
+        : Logger(threshold)
+    {}
+
+protected:
+    void log_message_internal(const isc::Message& message) const noexcept override
+    {
+        benchmark::DoNotOptimize(message.code());
+    }
+
+    void log_record_internal(const isc::Record& record) const noexcept override
+    {
+        benchmark::DoNotOptimize(record.code());
+    }
+};
+
+/**
+ * A logger that formats every message like a text sink would, and then discards it.
+ */
+class FormattingLogger
+        : public isc::Logger
+{
+public:
+    explicit FormattingLogger(const isc::Message::Severity threshold) noexcept
+        : Logger(threshold)
+    {}
+
+protected:
+    void log_message_internal(const isc::Message& message) const noexcept override
+    {
+        thread_local std::string t_text;
+        try
+        {
+            t_text.clear();
+            message.format_to(t_text);
+            benchmark::DoNotOptimize(t_text.data());
+        }
+        catch (...)
+        {}
+    }
+};
+
+const std::string s_description = "The requested resource was not found.";
+
+// Shared between the threads of a benchmark, set up and torn down by its first thread.
+std::unique_ptr<NullLogger> s_null_logger;
+std::unique_ptr<FormattingLogger> s_formatting_logger;
+std::unique_ptr<isc::AsyncLogger> s_async_logger;
+std::unique_ptr<isc::StagingLogger> s_staging_logger;
+std::unique_ptr<isc::RateLimiter> s_rate_limiter;
+std::unique_ptr<isc::FlightRecorder> s_flight_recorder;
+std::unique_ptr<isc::Metrics> s_metrics;
+std::unique_ptr<isc::MetricsLogger> s_metrics_logger;
+
+// Arguments are {filtered}, whether the messages are below the logger's threshold.
+isc::Message::Severity threshold_for(const benchmark::State& state)
+{
+    return state.range(0) == 0 ? isc::Message::Severity::Debug : isc::Message::Severity::Fatal;
+}
+
+void BM_LogMessage(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+        s_null_logger = std::make_unique<NullLogger>(threshold_for(state));
+
+    isc::bench::LatencyRecorder latency;
+    const isc::bench::AllocationCounter allocations;
+
+    for (auto _ : state)
+    {
+        const isc::bench::ScopedLatency scope(latency);
+        s_null_logger->log_message(isc::ErrorMessage(404, "Not Found", s_description));
+    }
+
+    allocations.report(state);
+    latency.report(state);
+
+    if (state.thread_index() == 0)
+        s_null_logger.reset();
+}
+BENCHMARK(BM_LogMessage)->ArgName("filtered")->DenseRange(0, 1)->ThreadRange(1, 8)->UseRealTime();
+
+void BM_LogMacro(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+        s_null_logger = std::make_unique<NullLogger>(threshold_for(state));
+
+    isc::bench::LatencyRecorder latency;
+    const isc::bench::AllocationCounter allocations;
+
+    for (auto _ : state)
+    {
+        const isc::bench::ScopedLatency scope(latency);
+        ISC_LOG(*s_null_logger, Error, 404, "Not Found", s_description);
+    }
+
+    allocations.report(state);
+    latency.report(state);
+
+    if (state.thread_index() == 0)
+        s_null_logger.reset();
+}
+BENCHMARK(BM_LogMacro)->ArgName("filtered")->DenseRange(0, 1)->ThreadRange(1, 8)->UseRealTime();
+
+void BM_LogFormatted(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+        s_formatting_logger = std::make_unique<FormattingLogger>(threshold_for(state));
+
+    isc::bench::LatencyRecorder latency;
+    const isc::bench::AllocationCounter allocations;
+
+    for (auto _ : state)
+    {
+        const isc::bench::ScopedLatency scope(latency);
+        ISC_LOG(*s_formatting_logger, Error, 404, "Not Found", s_description);
+    }
+
+    allocations.report(state);
+    latency.report(state);
+
+    if (state.thread_index() == 0)
+        s_formatting_logger.reset();
+}
+BENCHMARK(BM_LogFormatted)->ArgName("filtered")->DenseRange(0, 1)->ThreadRange(1, 8)->UseRealTime();
+
+// Arguments are {filtered, trace frames}.
+void BM_LogAsync(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        s_null_logger  = std::make_unique<NullLogger>(isc::Message::Severity::Debug);
+        s_async_logger = std::make_unique<isc::AsyncLogger>(*s_null_logger, 1 << 16, isc::AsyncLogger::OverflowPolicy::Block);
+        s_async_logger->set_severity(threshold_for(state));
+    }
+
+    isc::ErrorMessage message(404, "Not Found", s_description);
+    for (std::int64_t i = 0; i < state.range(1); ++i)
+        message.add_trace("while handling a request");
+
+    isc::bench::LatencyRecorder latency;
+    const isc::bench::AllocationCounter allocations;
+
+    for (auto _ : state)
+    {
+        const isc::bench::ScopedLatency scope(latency);
+        s_async_logger->log_message(message);
+    }
+
+    allocations.report(state);
+    latency.report(state);
+
+    if (state.thread_index() == 0)
+    {
+        s_async_logger->flush();
+        s_async_logger.reset();
+        s_null_logger.reset();
+    }
+}
+BENCHMARK(BM_LogAsync)
+    ->ArgNames({"filtered", "trace"})
+    ->Args({0, 0})
+    ->Args({1, 0})
+    ->Args({0, 4})
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+void BM_LogStaging(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        s_null_logger    = std::make_unique<NullLogger>(isc::Message::Severity::Debug);
+        s_staging_logger = std::make_unique<isc::StagingLogger>(*s_null_logger);
+        s_staging_logger->set_severity(threshold_for(state));
+    }
+
+    isc::bench::LatencyRecorder latency;
+    const isc::bench::AllocationCounter allocations;
+
+    for (auto _ : state)
+    {
+        const isc::bench::ScopedLatency scope(latency);
+        s_staging_logger->log_message(isc::NoticeMessage(404, "Not Found", s_description));
+    }
+
+    allocations.report(state);
+    latency.report(state);
+
+    if (state.thread_index() == 0)
+    {
+        s_staging_logger->flush();
+        s_staging_logger.reset();
+        s_null_logger.reset();
+    }
+}
+BENCHMARK(BM_LogStaging)->ArgName("filtered")->DenseRange(0, 1)->ThreadRange(1, 8)->UseRealTime();
+
+// Every call after the burst is suppressed, so this measures the cost of the limiter's check against building the message.
+void BM_LogLimited(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        s_null_logger  = std::make_unique<NullLogger>(isc::Message::Severity::Debug);
+        s_rate_limiter = std::make_unique<isc::RateLimiter>(*s_null_logger);
+    }
+
+    isc::bench::LatencyRecorder latency;
+    const isc::bench::AllocationCounter allocations;
+
+    for (auto _ : state)
+    {
+        const isc::bench::ScopedLatency scope(latency);
+        ISC_LOG_LIMITED(*s_rate_limiter, Notice, 404, "Not Found", s_description);
+    }
+
+    allocations.report(state);
+    latency.report(state);
+
+    if (state.thread_index() == 0)
+    {
+        s_rate_limiter.reset();
+        s_null_logger.reset();
+    }
+}
+BENCHMARK(BM_LogLimited)->ThreadRange(1, 8)->UseRealTime();
+
+// Every message is below the sink's threshold, so this measures building the message and capturing it into the ring.
+void BM_LogRecorded(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        s_null_logger     = std::make_unique<NullLogger>(isc::Message::Severity::Warning);
+        s_flight_recorder = std::make_unique<isc::FlightRecorder>(*s_null_logger);
+    }
+
+    isc::bench::LatencyRecorder latency;
+    const isc::bench::AllocationCounter allocations;
+
+    for (auto _ : state)
+    {
+        const isc::bench::ScopedLatency scope(latency);
+        ISC_LOG(*s_flight_recorder, Debug, 404, "Not Found", s_description);
+    }
+
+    allocations.report(state);
+    latency.report(state);
+
+    if (state.thread_index() == 0)
+    {
+        s_flight_recorder.reset();
+        s_null_logger.reset();
+    }
+}
+BENCHMARK(BM_LogRecorded)->ThreadRange(1, 8)->UseRealTime();
+
+// Like BM_LogMessage, with every message counted, and timed if the sink's threshold lets it through.
+void BM_LogMetered(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        s_null_logger    = std::make_unique<NullLogger>(threshold_for(state));
+        s_metrics        = std::make_unique<isc::Metrics>();
+        s_metrics_logger = std::make_unique<isc::MetricsLogger>(*s_null_logger, *s_metrics);
+    }
+
+    isc::bench::LatencyRecorder latency;
+    const isc::bench::AllocationCounter allocations;
+
+    for (auto _ : state)
+    {
+        const isc::bench::ScopedLatency scope(latency);
+        s_metrics_logger->log_message(isc::ErrorMessage(404, "Not Found", s_description));
+    }
+
+    allocations.report(state);
+    latency.report(state);
+
+    if (state.thread_index() == 0)
+    {
+        s_metrics_logger.reset();
+        s_metrics.reset();
+        s_null_logger.reset();
+    }
+}
+BENCHMARK(BM_LogMetered)->ArgName("filtered")->Arg(0)->Arg(1)->ThreadRange(1, 8)->UseRealTime();
+}
@@ -0,0 +1,268 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include <string>
+
+#include <ISCLogs/ISCLogs.hpp>
+
+#include "Support.hpp"
+
+namespace
+{
+// Short strings fit inline in a NoThrowString, long ones are allocated and shared.
+const std::string s_short_name        = "Not Found";
+const std::string s_short_description = "The resource was missing.";
+const std::string s_long_name         = "A Rather Long Name That Does Not Fit Inline In A NoThrowString";
+const std::string s_long_description  = "A description long enough that it has to be stored on the heap, as most real descriptions are.";
+
+// The same strings, registered so that messages reference them instead of copying them.
+constexpr isc::CodeRegistry s_codes({
+    {404, "Not Found", "The resource was missing.", isc::Message::Severity::Error},
+    {
+        405,
+        "A Rather Long Name That Does Not Fit Inline In A NoThrowString",
+        "A description long enough that it has to be stored on the heap, as most real descriptions are.",
+        isc::Message::Severity::Error
+    },
+});
+
+const std::string& name_for(const benchmark::State& state)
+{
+    return state.range(0) == 0 ? s_short_name : s_long_name;
+}
+
+const std::string& description_for(const benchmark::State& state)
+{
+    return state.range(0) == 0 ? s_short_description : s_long_description;
+}
+
+isc::ErrorMessage make_message(const benchmark::State& state)
+{
+    isc::ErrorMessage message(404, name_for(state), description_for(state));
+    for (std::int64_t i = 0; i < state.range(1); ++i)
+        message.add_trace("while handling a request");
+
+    return message;
+}
+
+isc::Message make_pooled_message(const benchmark::State& state)
+{
+    isc::Message message(isc::util::MemoryPool::global(), 404, name_for(state), description_for(state), isc::Message::Severity::Error);
+    for (std::int64_t i = 0; i < state.range(1); ++i)
+        message.add_trace("while handling a request");
+
+    return message;
+}
+
+// Arguments are {long strings, trace frames}.
+void message_arguments(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"long", "trace"})->Args({0, 0})->Args({1, 0})->Args({0, 4})->Args({1, 4});
+}
+
+void BM_MessageConstruct(benchmark::State& state)
+{
+    isc::bench::LatencyRecorder latency;
+    const isc::bench::AllocationCounter allocations;
+
+    for (auto _ : state)
+    {
+        const isc::bench::ScopedLatency scope(latency);
+        isc::ErrorMessage message = make_message(state);
+        benchmark::DoNotOptimize(message);
+    }
+
+    allocations.report(state);
+    latency.report(state);
+}
+BENCHMARK(BM_MessageConstruct)->Apply(message_arguments);
+
+// Constructing a message from a registered code, which references its name and description.
+void BM_MessageRegistered(benchmark::State& state)
+{
+    isc::bench::LatencyRecorder latency;
+    const isc::bench::AllocationCounter allocations;
+    const isc::CodeInfo& info = *s_codes.find(state.range(0) == 0 ? 404 : 405);
+
+    for (auto _ : state)
+    {
+        const isc::bench::ScopedLatency scope(latency);
+        isc::Message message(info);
+        benchmark::DoNotOptimize(message);
+    }
+
+    allocations.report(state);
+    latency.report(state);
+}
+BENCHMARK(BM_MessageRegistered)->ArgName("long")->Arg(0)->Arg(1);
+
+// The whole life of a message that is created, rendered and destroyed, with its storage allocated from a pool.
+void BM_MessagePooledLifecycle(benchmark::State& state)
+{
+    isc::bench::LatencyRecorder latency;
+    const isc::bench::AllocationCounter allocations;
+
+    for (auto _ : state)
+    {
+        const isc::bench::ScopedLatency scope(latency);
+        const isc::Message message = make_pooled_message(state);
+        benchmark::DoNotOptimize(message.what());
+    }
+
+    allocations.report(state);
+    latency.report(state);
+}
+BENCHMARK(BM_MessagePooledLifecycle)->Apply(message_arguments);
+
+// The same life, with the storage allocated from the global heap.
+void BM_MessageHeapLifecycle(benchmark::State& state)
+{
+    isc::bench::LatencyRecorder latency;
+    const isc::bench::AllocationCounter allocations;
+
+    for (auto _ : state)
+    {
+        const isc::bench::ScopedLatency scope(latency);
+        const isc::ErrorMessage message = make_message(state);
+        benchmark::DoNotOptimize(message.what());
+    }
+
+    allocations.report(state);
+    latency.report(state);
+}
+BENCHMARK(BM_MessageHeapLifecycle)->Apply(message_arguments);
+
+void BM_MessageCopy(benchmark::State& state)
+{
+    const isc::ErrorMessage original = make_message(state);
+    isc::bench::LatencyRecorder latency;
+    const isc::bench::AllocationCounter allocations;
+
+    for (auto _ : state)
+    {
+        const isc::bench::ScopedLatency scope(latency);
+        isc::ErrorMessage copy = original;
+        benchmark::DoNotOptimize(copy);
+    }
+
+    allocations.report(state);
+    latency.report(state);
+}
+BENCHMARK(BM_MessageCopy)->Apply(message_arguments);
+
+void BM_MessageFormat(benchmark::State& state)
+{
+    const isc::ErrorMessage message = make_message(state);
+    isc::bench::LatencyRecorder latency;
+    const isc::bench::AllocationCounter allocations;
+
+    for (auto _ : state)
+    {
+        const isc::bench::ScopedLatency scope(latency);
+        std::string text = message.message();
+        benchmark::DoNotOptimize(text);
+    }
+
+    allocations.report(state);
+    latency.report(state);
+}
+BENCHMARK(BM_MessageFormat)->Apply(message_arguments);
+
+void BM_MessageFormatTo(benchmark::State& state)
+{
+    const isc::ErrorMessage message = make_message(state);
+    std::string text;
+    isc::bench::LatencyRecorder latency;
+    const isc::bench::AllocationCounter allocations;
+
+    for (auto _ : state)
+    {
+        const isc::bench::ScopedLatency scope(latency);
+        text.clear();
+        message.format_to(text);
+        benchmark::DoNotOptimize(text);
+    }
+
+    allocations.report(state);
+    latency.report(state);
+}
+BENCHMARK(BM_MessageFormatTo)->Apply(message_arguments);
+
+// The first what() of a message formats it, later calls, like those of every handler that catches and logs it, reuse the text.
+void BM_MessageWhat(benchmark::State& state)
+{
+    const isc::ErrorMessage message = make_message(state);
+    isc::bench::LatencyRecorder latency;
+    const isc::bench::AllocationCounter allocations;
+
+    for (auto _ : state)
+    {
+        const isc::bench::ScopedLatency scope(latency);
+        benchmark::DoNotOptimize(message.what());
+    }
+
+    allocations.report(state);
+    latency.report(state);
+}
+BENCHMARK(BM_MessageWhat)->Apply(message_arguments);
+
+void BM_RecordCapture(benchmark::State& state)
+{
+    const isc::ErrorMessage message = make_message(state);
+    isc::bench::LatencyRecorder latency;
+    const isc::bench::AllocationCounter allocations;
+
+    for (auto _ : state)
+    {
+        const isc::bench::ScopedLatency scope(latency);
+        isc::Record record(message);
+        benchmark::DoNotOptimize(record);
+        record.release();
+    }
+
+    allocations.report(state);
+    latency.report(state);
+}
+BENCHMARK(BM_RecordCapture)->Apply(message_arguments);
+
+// Arguments are {storage}, 0 for a static string, 1 for an inline string, and 2 for a shared string.
+void BM_NoThrowStringCopy(benchmark::State& state)
+{
+    const isc::util::NoThrowString original = state.range(0) == 0 ? isc::util::NoThrowString::from_static(s_long_name)
+                                              : state.range(0) == 1 ? isc::util::NoThrowString(s_short_name)
+                                                                    : isc::util::NoThrowString(s_long_name);
+    isc::bench::LatencyRecorder latency;
+    const isc::bench::AllocationCounter allocations;
+
+    for (auto _ : state)
+    {
+        const isc::bench::ScopedLatency scope(latency);
+        isc::util::NoThrowString copy = original;
+        benchmark::DoNotOptimize(copy);
+    }
+
+    allocations.report(state);
+    latency.report(state);
+}
+BENCHMARK(BM_NoThrowStringCopy)->ArgName("storage")->DenseRange(0, 2);
+
+// Arguments are {long string}.
+void BM_NoThrowStringConstruct(benchmark::State& state)
+{
+    const std::string& string = name_for(state);
+    isc::bench::LatencyRecorder latency;
+    const isc::bench::AllocationCounter allocations;
+
+    for (auto _ : state)
+    {
+        const isc::bench::ScopedLatency scope(latency);
+        isc::util::NoThrowString copy(string);
+        benchmark::DoNotOptimize(copy);
+    }
+
+    allocations.report(state);
+    latency.report(state);
+}
+BENCHMARK(BM_NoThrowStringConstruct)->ArgName("long")->DenseRange(0, 1);
+}
@@ -0,0 +1,247 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "Support.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+// Counted per thread, so that counting does not become a point of contention in the threaded benchmarks.
+thread_local std::uint64_t t_allocations = 0;
+
+void* allocate(std::size_t size, const std::nothrow_t&) noexcept
+{
+#if !defined(__GLIBC__)
+    ++t_allocations;
+#endif
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* allocate(const std::size_t size)
+{
+    void* memory = allocate(size, std::nothrow);
+    if (memory == nullptr)
+        throw std::bad_alloc();
+
+    return memory;
+}
+
+void* allocate(std::size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    // Not made through malloc, so counted here either way.
+    ++t_allocations;
+    const auto align = std::max(static_cast<std::size_t>(alignment), sizeof(void*));
+    size             = (std::max<std::size_t>(size, 1) + align - 1) / align * align;
+    return std::aligned_alloc(align, size);
+}
+
+void* allocate(const std::size_t size, const std::align_val_t alignment)
+{
+    void* memory = allocate(size, alignment, std::nothrow);
+    if (memory == nullptr)
+        throw std::bad_alloc();
+
+    return memory;
+}
+}
+
+#if defined(__GLIBC__)
+// With glibc, malloc itself is replaced, so memory the library takes straight from malloc is counted too, e.g. the spill
+// storage of records and fields. operator new goes through malloc, so it does not count on its own.
+extern "C"
+{
+void* __libc_malloc(std::size_t size) noexcept;
+void* __libc_calloc(std::size_t count, std::size_t size) noexcept;
+void* __libc_realloc(void* memory, std::size_t size) noexcept;
+void __libc_free(void* memory) noexcept;
+
+void* malloc(const std::size_t size) noexcept
+{
+    ++t_allocations;
+    return __libc_malloc(size);
+}
+
+void* calloc(const std::size_t count, const std::size_t size) noexcept
+{
+    ++t_allocations;
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* memory, const std::size_t size) noexcept
+{
+    ++t_allocations;
+    return __libc_realloc(memory, size);
+}
+
+void free(void* memory) noexcept
+{
+    __libc_free(memory);
+}
+}
+#endif
+
+void* operator new(const std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new[](const std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new(const std::size_t size, const std::nothrow_t& tag) noexcept
+{
+    return allocate(size, tag);
+}
+
+void* operator new[](const std::size_t size, const std::nothrow_t& tag) noexcept
+{
+    return allocate(size, tag);
+}
+
+void* operator new(const std::size_t size, const std::align_val_t alignment)
+{
+    return allocate(size, alignment);
+}
+
+void* operator new[](const std::size_t size, const std::align_val_t alignment)
+{
+    return allocate(size, alignment);
+}
+
+void* operator new(const std::size_t size, const std::align_val_t alignment, const std::nothrow_t& tag) noexcept
+{
+    return allocate(size, alignment, tag);
+}
+
+void* operator new[](const std::size_t size, const std::align_val_t alignment, const std::nothrow_t& tag) noexcept
+{
+    return allocate(size, alignment, tag);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    std::free(memory);
+}
+
+namespace isc::bench
+{
+std::uint64_t thread_allocations() noexcept
+{
+    return t_allocations;
+}
+
+AllocationCounter::AllocationCounter() noexcept
+    : m_start(thread_allocations())
+{}
+
+void AllocationCounter::report(benchmark::State& state) const
+{
+    const auto allocations = static_cast<double>(thread_allocations() - m_start);
+    state.counters["allocs/op"] = benchmark::Counter(allocations, benchmark::Counter::kAvgIterations);
+}
+
+LatencyRecorder::LatencyRecorder(const std::size_t max_samples)
+    : m_samples(max_samples)
+{}
+
+void LatencyRecorder::start() noexcept
+{
+    m_sampling = m_iteration++ % sample_interval == 0 && m_size < m_samples.size();
+    if (m_sampling)
+        m_start = Clock::now();
+}
+
+void LatencyRecorder::stop() noexcept
+{
+    if (m_sampling)
+        m_samples[m_size++] = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_start).count();
+}
+
+void LatencyRecorder::report(benchmark::State& state)
+{
+    if (m_size == 0)
+        return;
+
+    const auto percentile = [this](const double fraction) {
+        const auto index = std::min(m_size - 1, static_cast<std::size_t>(fraction * static_cast<double>(m_size)));
+        std::nth_element(m_samples.begin(), m_samples.begin() + static_cast<std::ptrdiff_t>(index), m_samples.begin() + static_cast<std::ptrdiff_t>(m_size));
+        return static_cast<double>(m_samples[index]);
+    };
+
+    state.counters["p50_ns"]  = benchmark::Counter(percentile(0.5), benchmark::Counter::kAvgThreads);
+    state.counters["p99_ns"]  = benchmark::Counter(percentile(0.99), benchmark::Counter::kAvgThreads);
+    state.counters["p999_ns"] = benchmark::Counter(percentile(0.999), benchmark::Counter::kAvgThreads);
+}
+
+ScopedLatency::ScopedLatency(LatencyRecorder& recorder) noexcept
+    : m_recorder(recorder)
+{
+    m_recorder.start();
+}
+
+ScopedLatency::~ScopedLatency() noexcept
+{
+    m_recorder.stop();
+}
+} // isc::bench
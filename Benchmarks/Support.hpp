@@ -0,0 +1,95 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace isc::bench
+{
+/**
+ * Returns the amount of allocations made by the calling thread so far, counted by the replaced global operator new,
+ * and by the replaced malloc with glibc.
+ */
+[[nodiscard]] std::uint64_t thread_allocations() noexcept;
+
+/**
+ * Counts the allocations the calling thread makes while a benchmark runs, and reports them per iteration.
+ */
+class AllocationCounter
+{
+public:
+    AllocationCounter() noexcept;
+
+    /**
+     * Adds the allocs/op counter to the benchmark.
+     * @param state The state of the benchmark, its iteration count must be final.
+     */
+    void report(benchmark::State& state) const;
+
+private:
+    std::uint64_t m_start;
+};
+
+/**
+ * Samples the latency of single iterations and reports the p50, p99 and p999 latencies in nanoseconds.
+ * Only every sample_interval-th iteration is timed, so that reading the clock barely shows up in ns/op.
+ */
+class LatencyRecorder
+{
+public:
+    static constexpr std::uint64_t sample_interval = 16;
+
+    /**
+     * @param max_samples The amount of samples to keep, the storage is allocated up front.
+     */
+    explicit LatencyRecorder(std::size_t max_samples = 1 << 20);
+
+    /**
+     * Starts timing an iteration, if it is one that gets sampled.
+     */
+    void start() noexcept;
+
+    /**
+     * Stops timing the iteration started by the last call to start.
+     */
+    void stop() noexcept;
+
+    /**
+     * Adds the p50, p99 and p999 counters to the benchmark, averaged over its threads.
+     * @param state The state of the benchmark.
+     */
+    void report(benchmark::State& state);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    std::vector<std::int64_t> m_samples;
+    std::size_t m_size        = 0;
+    std::uint64_t m_iteration = 0;
+    bool m_sampling           = false;
+    Clock::time_point m_start;
+};
+
+/**
+ * Times a single iteration through a LatencyRecorder.
+ */
+class ScopedLatency
+{
+public:
+    explicit ScopedLatency(LatencyRecorder& recorder) noexcept;
+    ~ScopedLatency() noexcept;
+
+    ScopedLatency(const ScopedLatency&)            = delete;
+    ScopedLatency& operator=(const ScopedLatency&) = delete;
+
+private:
+    LatencyRecorder& m_recorder;
+};
+} // isc::bench
@@ -0,0 +1,7 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include <benchmark/benchmark.h>
+
+BENCHMARK_MAIN();
@@ -0,0 +1,174 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "ISCLogs/Logger.hpp"
+#include "ISCLogs/RingBuffer.hpp"
+
+namespace isc
+{
+class Metrics;
+
+/**
+ * A logger that hands messages to a worker thread, which then logs them through another logger.
+ * The calling thread only pays for capturing the message as a record in a bounded ring buffer.
+ */
+class AsyncLogger
+        : public Logger
+{
+public:
+    /**
+     * What to do with a message when the ring buffer is full.
+     */
+    enum class OverflowPolicy
+    {
+        Block,      // Wait until the worker has made room for the message.
+        DropNewest, // Discard the message that could not be queued.
+        DropOldest  // Discard the oldest queued message to make room for the new one.
+    };
+
+    /**
+     * Constructs the logger and starts its worker thread.
+     * The logger accepts every severity by default and leaves the filtering to the sink, use set_severity to filter earlier.
+     * @param sink The logger that the worker thread will log messages through, it must outlive this logger.
+     * @param capacity The amount of messages that can be queued, rounded up to a power of two.
+     * @param policy What to do with messages that do not fit in the queue, fatal messages are always queued as if it was Block,
+     * and never dropped to make room for others.
+     */
+    explicit AsyncLogger(Logger& sink, std::size_t capacity = 8192, OverflowPolicy policy = OverflowPolicy::Block) noexcept;
+    ~AsyncLogger() noexcept override;
+
+    AsyncLogger(const AsyncLogger&)            = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+    /**
+     * Blocks until every message queued before the call has been logged by the sink.
+     */
+    void flush() noexcept;
+
+    /**
+     * Logs every queued message and stops the worker thread.
+     * Messages logged after shutting down are passed straight to the sink on the calling thread.
+     */
+    void shutdown() noexcept;
+
+    /**
+     * Returns the amount of messages that were dropped because the queue was full.
+     */
+    [[nodiscard]] std::uint64_t dropped() const noexcept;
+
+    /**
+     * Sets the metrics that the depth of the queue and the dropped messages are counted into, or nullptr to stop counting.
+     * Safe to call while other threads are logging.
+     * @param metrics The metrics, they must outlive this logger or be unset first.
+     */
+    void set_metrics(Metrics* metrics) noexcept;
+
+protected:
+    /**
+     * Queues a message for the worker thread, applying the overflow policy if the queue is full.
+     * @param message The message to log.
+     */
+    void log_message_internal(const Message& message) const noexcept override;
+
+    /**
+     * Queues a copy of a record for the worker thread, applying the overflow policy if the queue is full.
+     * @param record The record to log.
+     */
+    void log_record_internal(const Record& record) const noexcept override;
+
+    /**
+     * Writes every queued record that the worker has not picked up yet, called by CrashHandler.
+     * @param writer The writer to write the records to.
+     */
+    void dump_pending_internal(util::SignalWriter& writer) const noexcept override;
+
+private:
+    friend class LogAwaitable;
+    friend class FlushAwaitable;
+
+    /**
+     * A coroutine waiting on the logger instead of blocking its thread, see LogAwaitable and FlushAwaitable.
+     */
+    struct Waiter
+    {
+        // Called once the wait is over, on whichever thread ended it, e.g. the worker thread.
+        void (*complete)(Waiter& waiter) noexcept = nullptr;
+        void* context                             = nullptr;
+        // The record to queue once there is room, or nullptr to wait until the messages queued before target are logged.
+        Record* record                            = nullptr;
+        std::uint64_t target                      = 0;
+        Waiter* next                              = nullptr;
+    };
+
+    /**
+     * Logs a record like log_record, except that it is not copied, and it is left alone if it could only be queued by
+     * waiting for room.
+     * @param record The record to log, released once it has been logged or dropped.
+     * @return Whether the record was taken care of, false if it has to wait.
+     */
+    bool try_log(Record& record) const noexcept;
+
+    /**
+     * Queues a waiter, unless what it waits for can already be done.
+     * @param waiter The waiter, it must stay alive until it is completed.
+     * @return Whether the waiter was queued, its complete function is only called if it was.
+     */
+    bool wait(Waiter& waiter) const noexcept;
+
+    /**
+     * Completes the waiters whose messages have been logged, or whose records could be queued.
+     * @param all Whether nothing is draining the queue anymore, so every waiter has to be completed.
+     */
+    void complete_waiters(bool all) const noexcept;
+
+    void run() noexcept;
+    void drain() noexcept;
+    void drain_queue() const noexcept;
+    void report_dropped() const noexcept;
+    void count_dropped() const noexcept;
+    void wake() const noexcept;
+    void enqueue(Record record) const noexcept;
+    bool try_enqueue(Record& record) const noexcept;
+    void notify_worker() const noexcept;
+    bool push_blocking(const Record& record) const noexcept;
+    bool push_dropping_oldest(const Record& record) const noexcept;
+
+    static constexpr std::size_t s_batch_size = 64;
+
+    Logger& m_sink;
+    OverflowPolicy m_policy;
+
+    mutable util::RingBuffer<Record> m_queue;
+    mutable std::atomic<std::uint64_t> m_processed        = 0;
+    mutable std::atomic<std::uint64_t> m_dropped          = 0;
+    mutable std::atomic<std::uint64_t> m_reported_dropped = 0;
+    // Held around every call to the sink, so it is never called from several threads at once, e.g. by the final drain
+    // and a producer that logs directly because the logger is closed.
+    mutable std::mutex m_sink_mutex;
+
+    mutable std::mutex m_mutex;
+    mutable std::condition_variable m_wake;
+    mutable std::atomic<bool> m_sleeping = false;
+    std::atomic<bool> m_stopping         = false;
+    // Set once there is no worker, or it has stopped for good, from then on messages are logged on the calling thread.
+    std::atomic<bool> m_closed           = false;
+    std::thread m_worker;
+    std::atomic<Metrics*> m_metrics      = nullptr;
+
+    mutable std::mutex m_waiters_mutex;
+    mutable Waiter* m_waiters                      = nullptr;
+    mutable Waiter* m_last_waiter                  = nullptr;
+    // Lets the worker skip the lock when nobody is waiting, which is nearly always.
+    mutable std::atomic<std::size_t> m_waiter_count = 0;
+};
+} // isc
@@ -0,0 +1,144 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "ISCLogs/Message.hpp"
+
+namespace isc::binary
+{
+/**
+ * The layout of a binary log segment, as written by BinaryLogger.
+ * A segment starts with a SegmentHeader, followed by entries that each start with an EntryHeader.
+ * Strings are written once per segment as String entries, and referred to by their id afterwards.
+ * An entry whose size is 0 marks the end of the segment. All values are in the byte order of the writer.
+ */
+inline constexpr char magic[8]           = {'I', 'S', 'C', 'L', 'O', 'G', 'S', '\0'};
+inline constexpr std::uint32_t version   = 1;
+inline constexpr std::uint32_t no_string = 0;
+
+struct SegmentHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t header_size;
+    std::uint64_t capacity;
+};
+
+enum class EntryKind : std::uint8_t
+{
+    String = 1, // Followed by a uint32 id and the characters of the string.
+    Record = 2  // Followed by RecordFields, the description, and the trace frames.
+};
+
+enum EntryFlags : std::uint8_t
+{
+    HasDescription = 1 << 0,
+    Deferred       = 1 << 1, // The description holds the encoded arguments of the string referred to by format_id.
+    Truncated      = 1 << 2
+};
+
+struct EntryHeader
+{
+    std::uint32_t size; // The size of the entry, including this header.
+    EntryKind kind;
+    std::uint8_t flags;
+    std::uint16_t trace_size;
+};
+
+// Followed by description_size bytes of description, then trace_size frames made of a uint32 size and their characters.
+struct RecordFields
+{
+    std::uint64_t timestamp;
+    std::uint64_t thread_id;
+    std::uint32_t code;
+    std::uint32_t line;
+    std::uint32_t column;
+    std::uint32_t file_id;
+    std::uint32_t function_id;
+    std::uint32_t name_id;
+    std::uint32_t format_id;
+    std::uint32_t description_size;
+    std::uint8_t severity;
+    std::uint8_t reserved[7];
+};
+
+/**
+ * A record read back from a segment. Its views point into the segment, and are valid as long as the reader is.
+ */
+struct Entry
+{
+    std::uint64_t timestamp        = 0;
+    std::uint64_t thread_id        = 0;
+    unsigned int code              = 0;
+    Message::Severity severity     = Message::Severity::Nominal;
+    bool has_description           = false;
+    bool truncated                 = false;
+    std::uint32_t line             = 0;
+    std::uint32_t column           = 0;
+    std::string_view file;
+    std::string_view function;
+    std::string_view name;
+    std::string_view description; // The format string if the description is deferred.
+    std::span<const std::byte> arguments;
+    bool deferred = false;
+    std::vector<std::string_view> trace;
+
+    /**
+     * Returns a string containing the information contained in the entry, formatted like Message::message().
+     */
+    [[nodiscard]] std::string message() const;
+
+    /**
+     * Appends the information contained in the entry to a string, formatted like Message::message().
+     * @param out The string to append to.
+     */
+    void format_to(std::string& out) const;
+};
+
+/**
+ * Reads the records of a segment file, by mapping it into memory.
+ */
+class Reader
+{
+public:
+    /**
+     * Opens a segment file, see is_open.
+     * @param path The path of the segment.
+     */
+    explicit Reader(const std::string& path) noexcept;
+    ~Reader() noexcept;
+
+    Reader(const Reader&)            = delete;
+    Reader& operator=(const Reader&) = delete;
+
+    /**
+     * Returns whether the file could be opened, and starts with a valid segment header.
+     */
+    [[nodiscard]] bool is_open() const noexcept;
+
+    /**
+     * Reads the next record in the segment.
+     * @param entry The entry to read the record into.
+     * @return Whether a record was read, false once the end of the segment is reached.
+     */
+    bool next(Entry& entry);
+
+private:
+    [[nodiscard]] std::string_view string(std::uint32_t id) const noexcept;
+
+    const std::byte* m_data = nullptr;
+    std::size_t m_size      = 0;
+    std::size_t m_offset    = 0;
+    std::unordered_map<std::uint32_t, std::string_view> m_strings;
+};
+} // isc::binary
@@ -0,0 +1,116 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "ISCLogs/BinaryFormat.hpp"
+#include "ISCLogs/Logger.hpp"
+
+namespace isc
+{
+class Metrics;
+
+/**
+ * A logger that appends compact binary records to pre-sized, memory mapped segment files, instead of formatting text.
+ * Names, files, functions and format strings are written once per segment and referred to by id, and deferred
+ * descriptions are written as their encoded arguments, so formatting is left to the isclogs-decode tool.
+ */
+class BinaryLogger
+        : public Logger
+{
+public:
+    /**
+     * Creates the first segment to log to.
+     * If the segment cannot be created, messages are discarded, see is_open.
+     * @param path The path of the segments, each segment is named path.N, with N counting up from the first unused number.
+     * @param segment_size The size of each segment, a new segment is started once a record does not fit in the current one.
+     * @param threshold The threshold above which a message will be logged.
+     */
+    explicit BinaryLogger(std::string path, std::size_t segment_size = 64 * 1024 * 1024, Message::Severity threshold = Message::Severity::Nominal) noexcept;
+    ~BinaryLogger() noexcept override;
+
+    BinaryLogger(const BinaryLogger&)            = delete;
+    BinaryLogger& operator=(const BinaryLogger&) = delete;
+
+    /**
+     * Asks the operating system to start writing the current segment to disk.
+     */
+    void flush() noexcept;
+
+    /**
+     * Returns whether a segment is open.
+     */
+    [[nodiscard]] bool is_open() const noexcept;
+
+    /**
+     * Sets the metrics that the bytes written to the segments are counted into, or nullptr to stop counting.
+     * Safe to call while other threads are logging.
+     * @param metrics The metrics, they must outlive this logger or be unset first.
+     */
+    void set_metrics(Metrics* metrics) noexcept;
+
+protected:
+    /**
+     * Appends a message to the current segment.
+     * @param message The message to log.
+     */
+    void log_message_internal(const Message& message) const noexcept override;
+
+    /**
+     * Appends a record to the current segment.
+     * @param record The record to log.
+     */
+    void log_record_internal(const Record& record) const noexcept override;
+
+private:
+    struct StringHash
+    {
+        using is_transparent = void;
+
+        std::size_t operator()(std::string_view string) const noexcept
+        {
+            return std::hash<std::string_view>()(string);
+        }
+    };
+
+    void write(const Record& record) const noexcept;
+    bool reserve(std::size_t size) const noexcept;
+    bool open_segment() const noexcept;
+    void close_segment() const noexcept;
+    std::uint32_t intern(std::uint32_t global_id) const noexcept;
+    std::uint32_t intern(std::string_view string) const noexcept;
+    std::uint32_t intern(const char* string) const noexcept;
+    void append_string(std::uint32_t id, std::string_view string) const noexcept;
+    void append(const void* data, std::size_t size) const noexcept;
+
+    std::string m_path;
+    std::size_t m_segment_size;
+
+    mutable std::mutex m_mutex;
+    mutable std::uint64_t m_segment_index = 0;
+    mutable int m_file                    = -1;
+    mutable std::byte* m_data             = nullptr;
+    mutable std::size_t m_used            = 0;
+    std::atomic<Metrics*> m_metrics       = nullptr;
+
+    // Strings in the global util::InternTable keep their id, the rest get ids local to the segment, starting at s_local_id.
+    // All of these are reset with every segment, so that each segment can be decoded on its own.
+    static constexpr std::uint32_t s_local_id = 0x80000000u;
+
+    mutable std::vector<bool> m_written_global;
+    mutable std::unordered_map<std::string, std::uint32_t, StringHash, std::equal_to<>> m_strings;
+    mutable std::unordered_map<const char*, std::uint32_t> m_static_strings;
+    mutable std::uint32_t m_next_id = s_local_id;
+};
+} // isc
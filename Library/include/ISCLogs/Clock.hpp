@@ -0,0 +1,52 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace isc
+{
+/**
+ * The clock messages are timestamped with, in nanoseconds since the Unix epoch.
+ * The source is chosen once for the whole process, and can be changed at any time.
+ */
+class Clock
+{
+public:
+    enum class Source : std::uint8_t
+    {
+        Realtime, // std::chrono::system_clock, the default.
+        Coarse,   // CLOCK_REALTIME_COARSE, which only ticks every few milliseconds but is far cheaper to read. Realtime where it is not available.
+        Steady,   // std::chrono::steady_clock, offset to the wall clock once, so timestamps never go backwards.
+        Tsc       // The CPU's time stamp counter, calibrated against the wall clock every calibration_period. Steady where there is no invariant TSC.
+    };
+
+    // How often the time stamp counter is calibrated against the wall clock, the first calibration happens min_calibration after the first read.
+    static constexpr std::chrono::milliseconds calibration_period = std::chrono::milliseconds(1000);
+    static constexpr std::chrono::milliseconds min_calibration    = std::chrono::milliseconds(10);
+
+    /**
+     * Returns the current time, in nanoseconds since the Unix epoch.
+     */
+    [[nodiscard]] static std::uint64_t now() noexcept;
+
+    /**
+     * Changes the source of the clock, for every thread.
+     * @param source The new source, sources that are not available fall back as described by Source.
+     */
+    static void set_source(Source source) noexcept;
+
+    /**
+     * Returns the source of the clock, after falling back.
+     */
+    [[nodiscard]] static Source source() noexcept;
+
+    /**
+     * Returns whether the CPU has a time stamp counter that ticks at a constant rate, in every power state.
+     */
+    [[nodiscard]] static bool has_invariant_tsc() noexcept;
+};
+} // isc
@@ -0,0 +1,201 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "ISCLogs/Macros.hpp"
+#include "ISCLogs/Message.hpp"
+
+namespace isc
+{
+/**
+ * A message code declared once, along with the name, description and severity that every message with the code shares.
+ */
+struct CodeInfo
+{
+    unsigned int code;
+    std::string_view name;
+    // Empty if messages with the code have no description unless they are given one.
+    std::string_view description;
+    Message::Severity severity;
+};
+
+/**
+ * A table of message codes that is built at compile time, and looked up through a perfect hash, so that finding a code
+ * costs two multiplications and one comparison. Messages constructed from a registered code reference its name and
+ * description instead of copying them, so they never allocate.
+ * Codes are split into small buckets, and each bucket is given a seed that sends all of its codes to free slots, which
+ * always succeeds quickly with a table at most half full. Registering a code twice fails to compile.
+ * Registries are meant to be constexpr variables at namespace scope, so that ISC_LOG_CODE can look codes up at compile time.
+ * @tparam N The amount of registered codes.
+ */
+template <std::size_t N>
+class CodeRegistry
+{
+public:
+    /**
+     * Builds the registry, at compile time.
+     * @param codes The codes to register, each code may only appear once.
+     */
+    consteval explicit CodeRegistry(const CodeInfo (&codes)[N]);
+
+    /**
+     * Finds a registered code.
+     * @param code The code to find.
+     * @return The registered code, or nullptr if it was not registered.
+     */
+    [[nodiscard]] constexpr const CodeInfo* find(unsigned int code) const noexcept;
+
+    /**
+     * Returns the amount of registered codes.
+     */
+    [[nodiscard]] constexpr std::size_t size() const noexcept;
+
+    [[nodiscard]] constexpr const CodeInfo* begin() const noexcept;
+    [[nodiscard]] constexpr const CodeInfo* end() const noexcept;
+
+private:
+    static constexpr std::size_t s_slot_count   = std::bit_ceil(N * 2 > 2 ? N * 2 : 2);
+    static constexpr std::size_t s_bucket_count = (N + 3) / 4 > 0 ? (N + 3) / 4 : 1;
+    // Seeds tried per bucket before giving up, which only happens for codes that were registered twice.
+    static constexpr std::uint32_t s_max_seed = 1u << 16;
+
+    [[nodiscard]] static constexpr std::uint32_t hash(unsigned int code, std::uint32_t seed) noexcept;
+    [[nodiscard]] static constexpr std::size_t bucket_of(unsigned int code) noexcept;
+
+    CodeInfo m_codes[N] = {};
+    std::uint32_t m_seeds[s_bucket_count] = {};
+    // The index of the code in each slot plus one, 0 for an empty slot.
+    std::uint32_t m_slots[s_slot_count] = {};
+};
+
+template <std::size_t N>
+consteval CodeRegistry<N>::CodeRegistry(const CodeInfo (&codes)[N])
+{
+    std::size_t bucket_sizes[s_bucket_count] = {};
+    std::size_t largest                      = 0;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        m_codes[i] = codes[i];
+        largest    = std::max(largest, ++bucket_sizes[bucket_of(codes[i].code)]);
+    }
+
+    // The largest buckets are the hardest to place, so they are placed first while the table is emptiest.
+    for (std::size_t size = largest; size > 0; --size)
+    {
+        for (std::size_t bucket = 0; bucket < s_bucket_count; ++bucket)
+        {
+            if (bucket_sizes[bucket] != size)
+                continue;
+
+            std::size_t members[N] = {};
+            std::size_t count      = 0;
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                if (bucket_of(m_codes[i].code) == bucket)
+                    members[count++] = i;
+            }
+
+            std::uint32_t seed = 0;
+            for (; seed < s_max_seed; ++seed)
+            {
+                std::size_t slots[N] = {};
+                bool placed          = true;
+                for (std::size_t i = 0; i < count && placed; ++i)
+                {
+                    slots[i] = hash(m_codes[members[i]].code, seed) & (s_slot_count - 1);
+                    placed   = m_slots[slots[i]] == 0;
+                    for (std::size_t j = 0; j < i && placed; ++j)
+                        placed = slots[j] != slots[i];
+                }
+
+                if (!placed)
+                    continue;
+
+                for (std::size_t i = 0; i < count; ++i)
+                    m_slots[slots[i]] = static_cast<std::uint32_t>(members[i] + 1);
+                m_seeds[bucket] = seed;
+                break;
+            }
+
+            if (seed == s_max_seed)
+                throw "A message code was registered more than once";
+        }
+    }
+}
+
+template <std::size_t N>
+constexpr const CodeInfo* CodeRegistry<N>::find(const unsigned int code) const noexcept
+{
+    const std::uint32_t index = m_slots[hash(code, m_seeds[bucket_of(code)]) & (s_slot_count - 1)];
+    if (index == 0 || m_codes[index - 1].code != code)
+        return nullptr;
+
+    return &m_codes[index - 1];
+}
+
+template <std::size_t N>
+constexpr std::size_t CodeRegistry<N>::size() const noexcept
+{
+    return N;
+}
+
+template <std::size_t N>
+constexpr const CodeInfo* CodeRegistry<N>::begin() const noexcept
+{
+    return m_codes;
+}
+
+template <std::size_t N>
+constexpr const CodeInfo* CodeRegistry<N>::end() const noexcept
+{
+    return m_codes + N;
+}
+
+template <std::size_t N>
+constexpr std::uint32_t CodeRegistry<N>::hash(const unsigned int code, const std::uint32_t seed) noexcept
+{
+    std::uint32_t value = static_cast<std::uint32_t>(code) ^ (seed * 0x9E3779B9u);
+    value ^= value >> 16;
+    value *= 0x85EBCA6Bu;
+    value ^= value >> 13;
+    value *= 0xC2B2AE35u;
+    value ^= value >> 16;
+    return value;
+}
+
+template <std::size_t N>
+constexpr std::size_t CodeRegistry<N>::bucket_of(const unsigned int code) noexcept
+{
+    return hash(code, 0xB5297A4Du) % s_bucket_count;
+}
+} // isc
+
+/**
+ * Logs a message with a registered code through a logger, without building the message unless it is going to be logged.
+ * The code is looked up at compile time, so an unregistered code fails to compile, and the severity registered with the
+ * code decides whether the call is compiled in, like with ISC_LOG.
+ * @param logger The logger to log the message through.
+ * @param registry The constexpr CodeRegistry that the code is registered in.
+ * @param code The code of the message, a constant expression.
+ * @param ... Optionally the description of the message, replacing the registered one.
+ */
+#define ISC_LOG_CODE(logger, registry, code, ...)                                                                      \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        constexpr const ::isc::CodeInfo* isc_log_info_ = (registry).find(code);                                        \
+        static_assert(isc_log_info_ != nullptr, "The message code is not registered");                                 \
+        if constexpr (isc_log_info_ != nullptr && isc_log_info_->severity >= ::isc::compiled_min_severity)             \
+        {                                                                                                              \
+            const ::isc::Logger& isc_log_logger_ = (logger);                                                           \
+            if (isc_log_logger_.should_log(isc_log_info_->severity))                                                   \
+                isc_log_logger_.log_message(::isc::Message(*isc_log_info_ __VA_OPT__(,) __VA_ARGS__));                 \
+        }                                                                                                              \
+    } while (false)
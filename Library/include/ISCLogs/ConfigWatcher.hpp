@@ -0,0 +1,49 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <string>
+#include <thread>
+
+#include "ISCLogs/LoggerRegistry.hpp"
+
+namespace isc
+{
+/**
+ * Watches a config file with inotify, and applies it to a LoggerRegistry every time it is written or replaced (Linux only).
+ * The file is read on a thread of its own, so threads that are logging only ever see the thresholds change.
+ */
+class ConfigWatcher
+{
+public:
+    /**
+     * Applies the config file once, and starts watching it.
+     * If the file cannot be watched, it is only applied once, see is_watching.
+     * @param path The path of the config file, see LoggerRegistry::apply for its format. It does not need to exist yet.
+     * @param registry The registry to apply the config to, it must outlive the watcher.
+     */
+    explicit ConfigWatcher(std::string path, LoggerRegistry& registry = LoggerRegistry::global()) noexcept;
+    ~ConfigWatcher() noexcept;
+
+    ConfigWatcher(const ConfigWatcher&)            = delete;
+    ConfigWatcher& operator=(const ConfigWatcher&) = delete;
+
+    /**
+     * Returns whether the file is being watched.
+     */
+    [[nodiscard]] bool is_watching() const noexcept;
+
+private:
+    void run() noexcept;
+
+    std::string m_path;
+    std::string m_file_name;
+    LoggerRegistry& m_registry;
+
+    int m_inotify = -1;
+    int m_wake    = -1;
+    std::thread m_thread;
+};
+} // isc
@@ -0,0 +1,213 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <coroutine>
+#include <string_view>
+
+#include "ISCLogs/AsyncLogger.hpp"
+#include "ISCLogs/TraceChain.hpp"
+
+namespace isc
+{
+/**
+ * Runs coroutines that were waiting on a logger, so that they carry on on their own event loop rather than on the
+ * logger's worker thread. Event loops implement it, and install themselves with Scope while they run.
+ */
+class Executor
+{
+public:
+    /**
+     * Installs an executor as the current one of the calling thread, for as long as the scope lives.
+     */
+    class Scope
+    {
+    public:
+        /**
+         * @param executor The executor that coroutines suspended on this thread are resumed through.
+         */
+        explicit Scope(Executor& executor) noexcept;
+        ~Scope() noexcept;
+
+        Scope(const Scope&)            = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Executor* m_previous;
+    };
+
+    virtual ~Executor() noexcept = default;
+
+    /**
+     * Schedules a coroutine to be resumed, called from any thread, e.g. the worker thread of an AsyncLogger.
+     * @param coroutine The coroutine to resume.
+     */
+    virtual void post(std::coroutine_handle<> coroutine) noexcept = 0;
+
+    /**
+     * Returns the executor installed on the calling thread, or nullptr if there is none.
+     */
+    [[nodiscard]] static Executor* current() noexcept;
+};
+
+/**
+ * The trace frames of a task, added to every message it logs through co_log.
+ * A thread keeps no trace context of its own, since the coroutines it runs interleave and move between threads.
+ * Instead the context is a variable of the coroutine, which lives in its frame and so carries over every co_await.
+ * Copies share their frames, so a coroutine can hand its context down to the ones it awaits for them to add to.
+ */
+class TraceContext
+{
+public:
+    /**
+     * A frame of the context, removed once it goes out of scope.
+     */
+    class Frame
+    {
+    public:
+        ~Frame() noexcept;
+
+        Frame(const Frame&)            = delete;
+        Frame& operator=(const Frame&) = delete;
+
+    private:
+        friend class TraceContext;
+
+        Frame(TraceContext& context, std::string_view frame) noexcept;
+
+        TraceContext& m_context;
+        util::TraceChain m_previous;
+    };
+
+    TraceContext() noexcept = default;
+
+    /**
+     * Adds a frame to the context, until the returned frame goes out of scope.
+     * @param frame The frame, e.g. the name of the task or of the request it handles.
+     */
+    [[nodiscard]] Frame enter(std::string_view frame) noexcept;
+
+    /**
+     * Adds the frames of the context to a message, innermost first, as if the message had been passed up through them.
+     * @param message The message to add the frames to.
+     */
+    void apply(Message& message) const noexcept;
+
+    /**
+     * Returns the frames of the context, outermost first.
+     */
+    [[nodiscard]] const util::TraceChain& frames() const noexcept;
+
+private:
+    util::TraceChain m_frames;
+};
+
+/**
+ * Awaits a message being queued by an AsyncLogger, see co_log.
+ */
+class LogAwaitable
+{
+public:
+    /**
+     * @param logger The logger to log the message through.
+     * @param message The message to log.
+     */
+    LogAwaitable(const AsyncLogger& logger, const Message& message) noexcept;
+
+    LogAwaitable(const LogAwaitable&)            = delete;
+    LogAwaitable& operator=(const LogAwaitable&) = delete;
+
+    /**
+     * Queues the message if there is room, or applies the overflow policy if it does not ask to wait.
+     * @return Whether the message was taken care of without suspending.
+     */
+    [[nodiscard]] bool await_ready() noexcept;
+
+    /**
+     * Waits for room in the queue, the message is queued as soon as there is some.
+     * @param coroutine The suspended coroutine.
+     * @return Whether the coroutine stays suspended, false if room was made in the meantime.
+     */
+    bool await_suspend(std::coroutine_handle<> coroutine) noexcept;
+
+    void await_resume() const noexcept;
+
+private:
+    static void complete(AsyncLogger::Waiter& waiter) noexcept;
+
+    const AsyncLogger& m_logger;
+    // Left empty if the logger's threshold filters the message out.
+    Record m_record;
+    bool m_filtered;
+    AsyncLogger::Waiter m_waiter;
+    std::coroutine_handle<> m_coroutine;
+    Executor* m_executor = nullptr;
+};
+
+/**
+ * Awaits every message queued in an AsyncLogger being logged by its sink, see co_flush.
+ */
+class FlushAwaitable
+{
+public:
+    /**
+     * @param logger The logger to flush.
+     */
+    explicit FlushAwaitable(AsyncLogger& logger) noexcept;
+
+    FlushAwaitable(const FlushAwaitable&)            = delete;
+    FlushAwaitable& operator=(const FlushAwaitable&) = delete;
+
+    /**
+     * Returns whether every message queued so far has been logged already.
+     */
+    [[nodiscard]] bool await_ready() noexcept;
+
+    /**
+     * Waits for the messages queued before the flush to be logged.
+     * @param coroutine The suspended coroutine.
+     * @return Whether the coroutine stays suspended, false if the messages were logged in the meantime.
+     */
+    bool await_suspend(std::coroutine_handle<> coroutine) noexcept;
+
+    void await_resume() const noexcept;
+
+private:
+    static void complete(AsyncLogger::Waiter& waiter) noexcept;
+
+    AsyncLogger& m_logger;
+    AsyncLogger::Waiter m_waiter;
+    std::coroutine_handle<> m_coroutine;
+    Executor* m_executor = nullptr;
+};
+
+/**
+ * Logs a message through an AsyncLogger from a coroutine, suspending the coroutine rather than blocking its thread
+ * while the queue is full. Overflow policies other than Block still drop messages without suspending.
+ * The coroutine is resumed through the executor of the thread it suspended on, or on the logger's worker thread if
+ * there is none, in which case it must not block on the logger before suspending again.
+ * @param logger The logger to log the message through.
+ * @param message The message to log.
+ * @return An awaitable that completes once the message has been queued.
+ */
+[[nodiscard]] LogAwaitable co_log(const AsyncLogger& logger, const Message& message) noexcept;
+
+/**
+ * Logs a message through an AsyncLogger from a coroutine, with the frames of the coroutine's trace context.
+ * @param logger The logger to log the message through.
+ * @param message The message to log.
+ * @param trace The trace context of the coroutine, see TraceContext.
+ * @return An awaitable that completes once the message has been queued.
+ */
+[[nodiscard]] LogAwaitable co_log(const AsyncLogger& logger, Message message, const TraceContext& trace) noexcept;
+
+/**
+ * Waits from a coroutine for every message queued in an AsyncLogger so far to be logged by its sink, like
+ * AsyncLogger::flush but suspending the coroutine instead of blocking its thread.
+ * @param logger The logger to flush.
+ * @return An awaitable that completes once the messages have been logged.
+ */
+[[nodiscard]] FlushAwaitable co_flush(AsyncLogger& logger) noexcept;
+} // isc
@@ -0,0 +1,89 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+
+#include "ISCLogs/Logger.hpp"
+
+namespace isc
+{
+/**
+ * Writes out the records that loggers are still holding on to when the process crashes.
+ * Loggers that buffer records, like AsyncLogger, StagingLogger and FileLogger, watch themselves for their whole lifetime.
+ * On a crash signal the handler writes a report, every watched logger's pending records and a backtrace, using only
+ * write(2) and memory reserved when it was installed, then lets the signal take its default course.
+ * Nothing is done on the logging path, the handler only looks at the loggers once a crash has happened.
+ */
+class CrashHandler
+{
+public:
+    struct Options
+    {
+        // The size of the buffer that the report is formatted into, reserved up front.
+        std::size_t emergency_size = 64 * 1024;
+        // The size of the stack that the handler runs on, so that it can still run after a stack overflow.
+        std::size_t alternate_stack_size = 64 * 1024;
+        // The most frames that the backtrace is cut short at, 0 to not write a backtrace.
+        std::size_t max_frames = 64;
+    };
+
+    // The most loggers that can be watched at once, loggers past this are not dumped on a crash.
+    static constexpr std::size_t max_loggers = 64;
+
+    CrashHandler() = delete;
+
+    /**
+     * Adds a logger to the loggers that are dumped on a crash. Safe to call from any thread.
+     * @param logger The logger to watch, it must be unwatched before it is destroyed.
+     * @return Whether the logger is watched, false if max_loggers are already watched.
+     */
+    static bool watch(const Logger& logger) noexcept;
+
+    /**
+     * Removes a logger from the loggers that are dumped on a crash.
+     * @param logger The logger to stop watching.
+     */
+    static void unwatch(const Logger& logger) noexcept;
+
+    /**
+     * Writes the pending records of every watched logger. It is async-signal-safe, for applications with their own crash handler.
+     * @param writer The writer to write the records to.
+     */
+    static void dump_pending(util::SignalWriter& writer) noexcept;
+
+#if !defined(_WIN32)
+    /**
+     * Installs the handler for SIGSEGV, SIGBUS, SIGFPE, SIGILL and SIGABRT with the default options.
+     * @param fd The file descriptor that the report is written to, e.g. STDERR_FILENO or a file opened beforehand.
+     * @return Whether the handler could be installed.
+     */
+    static bool install(int fd) noexcept;
+
+    /**
+     * Installs the handler for SIGSEGV, SIGBUS, SIGFPE, SIGILL and SIGABRT.
+     * The emergency buffer and the calling thread's alternate stack are mapped and touched here, so the handler never allocates.
+     * Installing again replaces the file descriptor and options.
+     * @param fd The file descriptor that the report is written to, e.g. STDERR_FILENO or a file opened beforehand.
+     * @param options How much memory to reserve, and how long the backtrace can be.
+     * @return Whether the handler could be installed.
+     */
+    static bool install(int fd, const Options& options) noexcept;
+
+    /**
+     * Gives the calling thread an alternate signal stack, so the handler can run if the thread overflows its stack.
+     * install does this for the thread that calls it, other threads that may overflow their stack should call this once.
+     * The stack is unmapped when the thread exits.
+     * @return Whether the thread has an alternate stack.
+     */
+    static bool protect_thread() noexcept;
+
+    /**
+     * Restores the signal handlers that were installed before install. The emergency buffer is kept for the next install.
+     */
+    static void uninstall() noexcept;
+#endif
+};
+} // isc
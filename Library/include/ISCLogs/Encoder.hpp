@@ -0,0 +1,77 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <string>
+
+#include "ISCLogs/Message.hpp"
+#include "ISCLogs/Record.hpp"
+
+namespace isc
+{
+/**
+ * The formats that loggers writing text can write messages in, one message per line.
+ */
+enum class Encoding
+{
+    Text,  // Message::message(), e.g. "[Error]: Name - Description key=value".
+    Json,  // One JSON object per message, with the fields in a nested "fields" object and the trace as an array.
+    Logfmt // Space separated key=value pairs, with the fields after the message's own keys.
+};
+
+/**
+ * Encodes messages and records as text, JSON or logfmt, for sinks that feed log pipelines.
+ * JSON and logfmt start with the time the message was constructed at, formatted by util::TimestampFormatter.
+ * Strings are escaped by util::append_json_string and util::append_logfmt_value, which copy runs that need no escaping whole.
+ */
+class Encoder
+{
+public:
+    /**
+     * Appends a message to a string in the given encoding, without a trailing newline.
+     * @param encoding The encoding to use.
+     * @param message The message to encode.
+     * @param out The string to append to.
+     */
+    static void encode(Encoding encoding, const Message& message, std::string& out);
+
+    /**
+     * Appends a record to a string in the given encoding, without a trailing newline.
+     * Records also carry the thread they were captured on.
+     * @param encoding The encoding to use.
+     * @param record The record to encode.
+     * @param out The string to append to.
+     */
+    static void encode(Encoding encoding, const Record& record, std::string& out);
+
+    /**
+     * Appends a message to a string as a JSON object.
+     * @param message The message to encode.
+     * @param out The string to append to.
+     */
+    static void json(const Message& message, std::string& out);
+
+    /**
+     * Appends a record to a string as a JSON object.
+     * @param record The record to encode.
+     * @param out The string to append to.
+     */
+    static void json(const Record& record, std::string& out);
+
+    /**
+     * Appends a message to a string as logfmt.
+     * @param message The message to encode.
+     * @param out The string to append to.
+     */
+    static void logfmt(const Message& message, std::string& out);
+
+    /**
+     * Appends a record to a string as logfmt.
+     * @param record The record to encode.
+     * @param out The string to append to.
+     */
+    static void logfmt(const Record& record, std::string& out);
+};
+} // isc
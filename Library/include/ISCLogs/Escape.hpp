@@ -0,0 +1,36 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace isc::util
+{
+/**
+ * Appends a string as a quoted JSON string, escaping quotes, backslashes and control characters.
+ * Text is scanned 16 bytes at a time with SSE2 where it is available, and runs that need no escaping are copied whole.
+ * @param string The string to append, bytes above 0x7F are copied as they are.
+ * @param out The string to append to.
+ */
+void append_json_string(std::string_view string, std::string& out);
+
+/**
+ * Appends a string as a logfmt value, left bare if it can be, or quoted and escaped like a JSON string
+ * if it is empty or contains spaces, equal signs, quotes, backslashes or control characters.
+ * @param string The string to append.
+ * @param out The string to append to.
+ */
+void append_logfmt_value(std::string_view string, std::string& out);
+
+/**
+ * Returns the position of the first character of a string that has to be escaped in a JSON string,
+ * or the size of the string if there is none.
+ * @param string The string to scan.
+ * @param from The position to start scanning from.
+ */
+[[nodiscard]] std::size_t find_json_escape(std::string_view string, std::size_t from = 0) noexcept;
+} // isc::util
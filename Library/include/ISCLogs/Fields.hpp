@@ -0,0 +1,213 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace isc::util
+{
+/**
+ * A typed key-value pair attached to a message, viewing storage owned by a Fields object or a record.
+ */
+struct Field
+{
+    enum class Type : std::uint8_t
+    {
+        Bool,
+        Int,
+        UInt,
+        Double,
+        String
+    };
+
+    std::string_view key;
+    Type type = Type::Int;
+
+    union
+    {
+        bool boolean;
+        std::int64_t integer;
+        std::uint64_t unsigned_integer;
+        double number;
+    };
+
+    std::string_view string;
+
+    /**
+     * Appends the value as JSON, strings are quoted and escaped, and numbers that are not finite are written as null.
+     * @param out The string to append to.
+     */
+    void append_json(std::string& out) const;
+
+    /**
+     * Appends the value as a logfmt value, quoted only if it has to be.
+     * @param out The string to append to.
+     */
+    void append_logfmt(std::string& out) const;
+};
+
+/**
+ * The key-value fields of a message, encoded back to back as the key, a type tag and the value, with strings copied in.
+ * Fields fit in an inline buffer unless there are many of them or they hold long strings, in which case they move to the heap.
+ * The encoded form can be copied as it is, which is how records carry fields.
+ */
+class Fields
+{
+public:
+    static constexpr std::size_t inline_capacity = 64;
+    static constexpr std::size_t max_key_size    = 255;
+
+    /**
+     * Iterates over encoded fields, in the order they were added.
+     */
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = Field;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = const Field&;
+
+        Iterator() noexcept = default;
+
+        [[nodiscard]] const Field& operator*() const noexcept;
+        Iterator& operator++() noexcept;
+        Iterator operator++(int) noexcept;
+
+        [[nodiscard]] bool operator==(const Iterator& other) const noexcept;
+
+    private:
+        friend class Fields;
+
+        explicit Iterator(std::span<const std::byte> encoded) noexcept;
+
+        std::span<const std::byte> m_encoded;
+        std::size_t m_offset = 0;
+        std::size_t m_next   = 0;
+        Field m_field{};
+    };
+
+    /**
+     * A range over encoded fields, that does not own them.
+     */
+    class View
+    {
+    public:
+        View() noexcept = default;
+        explicit View(std::span<const std::byte> encoded) noexcept;
+
+        [[nodiscard]] bool empty() const noexcept;
+        [[nodiscard]] Iterator begin() const noexcept;
+        [[nodiscard]] Iterator end() const noexcept;
+
+    private:
+        std::span<const std::byte> m_encoded;
+    };
+
+    Fields() noexcept = default;
+    ~Fields() noexcept;
+
+    Fields(const Fields& fields) noexcept;
+    Fields& operator=(const Fields& fields) noexcept;
+
+    Fields(Fields&& fields) noexcept;
+    Fields& operator=(Fields&& fields) noexcept;
+
+    /**
+     * Rebuilds fields from their encoded form, as returned by encoded().
+     * @param encoded The encoded fields.
+     */
+    [[nodiscard]] static Fields from_encoded(std::span<const std::byte> encoded) noexcept;
+
+    /**
+     * Adds a field. Values must be booleans, numbers, or strings.
+     * If the field cannot be stored because memory is exhausted, it is dropped.
+     * @param key The key of the field, cut short after max_key_size characters.
+     * @param value The value of the field.
+     */
+    template <typename T>
+    void add(std::string_view key, const T& value) noexcept;
+
+    /**
+     * Returns whether there are no fields.
+     */
+    [[nodiscard]] bool empty() const noexcept;
+
+    /**
+     * Returns the encoded fields.
+     */
+    [[nodiscard]] std::span<const std::byte> encoded() const noexcept;
+
+    /**
+     * Returns a range over the fields.
+     */
+    [[nodiscard]] View view() const noexcept;
+
+    [[nodiscard]] Iterator begin() const noexcept;
+    [[nodiscard]] Iterator end() const noexcept;
+
+    /**
+     * Appends every field of an encoded range as " key=value", with values formatted for logfmt.
+     * @param fields The fields to append.
+     * @param out The string to append to.
+     */
+    static void format_to(View fields, std::string& out);
+
+private:
+    void append(std::string_view key, Field::Type type, const void* value, std::size_t size) noexcept;
+    [[nodiscard]] bool reserve(std::size_t size) noexcept;
+    void copy_from(std::span<const std::byte> encoded) noexcept;
+    void release() noexcept;
+
+    [[nodiscard]] std::byte* data() noexcept;
+
+    std::byte* m_heap        = nullptr;
+    std::uint32_t m_size     = 0;
+    std::uint32_t m_capacity = inline_capacity;
+    // Only the first m_size bytes are ever read, so the buffer is left uninitialised.
+    std::byte m_inline[inline_capacity];
+};
+
+template <typename T>
+void Fields::add(const std::string_view key, const T& value) noexcept
+{
+    using Decayed = std::remove_cvref_t<T>;
+
+    if constexpr (std::is_same_v<Decayed, bool>)
+    {
+        const auto byte = static_cast<std::uint8_t>(value);
+        append(key, Field::Type::Bool, &byte, sizeof(byte));
+    }
+    else if constexpr (std::is_integral_v<Decayed> && !std::is_same_v<Decayed, char> && std::is_signed_v<Decayed>)
+    {
+        const auto number = static_cast<std::int64_t>(value);
+        append(key, Field::Type::Int, &number, sizeof(number));
+    }
+    else if constexpr (std::is_integral_v<Decayed> && !std::is_same_v<Decayed, char>)
+    {
+        const auto number = static_cast<std::uint64_t>(value);
+        append(key, Field::Type::UInt, &number, sizeof(number));
+    }
+    else if constexpr (std::is_floating_point_v<Decayed>)
+    {
+        const auto number = static_cast<double>(value);
+        append(key, Field::Type::Double, &number, sizeof(number));
+    }
+    else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+    {
+        const std::string_view string(value);
+        append(key, Field::Type::String, string.data(), string.size());
+    }
+    else
+        static_assert(sizeof(T) == 0, "Field values must be booleans, numbers, or strings");
+}
+} // isc::util
@@ -0,0 +1,167 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <sys/uio.h>
+
+#include "ISCLogs/Encoder.hpp"
+#include "ISCLogs/Logger.hpp"
+#include "ISCLogs/RenderCache.hpp"
+
+namespace isc
+{
+class Metrics;
+
+/**
+ * A logger that writes messages to a file, one per line.
+ * Lines are formatted into large in-memory buffers that are written in batches with a single writev call,
+ * while a second set of buffers keeps accepting lines, so writers only wait on the disk when both sets are full.
+ */
+class FileLogger
+        : public Logger
+{
+public:
+    /**
+     * When the file is synchronised with the disk after a batch has been written.
+     */
+    enum class FsyncPolicy
+    {
+        Never,    // Leave it to the operating system.
+        PerBatch, // After every batch.
+        OnError   // After every batch containing a message of severity Error or higher, which is also written immediately.
+    };
+
+    struct Options
+    {
+        // The size of each buffer that lines are formatted into.
+        std::size_t buffer_size = 64 * 1024;
+        // The amount of buffers written in one batch.
+        std::size_t buffer_count = 4;
+        // The longest a line waits in a buffer while messages keep being logged, 0 to only write full batches.
+        std::chrono::milliseconds flush_interval = std::chrono::milliseconds(1000);
+        // The size after which the file is rotated, 0 to never rotate on size.
+        std::uint64_t max_file_size = 0;
+        // The age after which the file is rotated, 0 to never rotate on age.
+        std::chrono::seconds rotation_interval = std::chrono::seconds(0);
+        // The amount of rotated files kept next to the current one.
+        std::size_t max_files = 5;
+        FsyncPolicy fsync = FsyncPolicy::Never;
+        // The format lines are written in.
+        Encoding encoding = Encoding::Text;
+        // Whether Text lines start with the time the message was constructed at, JSON and logfmt lines always do.
+        bool timestamps = true;
+    };
+
+    /**
+     * Opens the file to log to with the default options, appending to it if it already exists.
+     * If the file cannot be opened, messages are discarded, see is_open.
+     * @param path The path of the file.
+     * @param threshold The threshold above which a message will be logged.
+     */
+    explicit FileLogger(std::string path, Message::Severity threshold = Message::Severity::Nominal) noexcept;
+
+    /**
+     * Opens the file to log to, appending to it if it already exists.
+     * If the file cannot be opened, messages are discarded, see is_open.
+     * @param path The path of the file, rotated files are named path.1, path.2 and so on, from newest to oldest.
+     * @param options How lines are buffered, and when the file is rotated and synchronised.
+     * @param threshold The threshold above which a message will be logged.
+     */
+    FileLogger(std::string path, const Options& options, Message::Severity threshold = Message::Severity::Nominal) noexcept;
+    ~FileLogger() noexcept override;
+
+    FileLogger(const FileLogger&)            = delete;
+    FileLogger& operator=(const FileLogger&) = delete;
+
+    /**
+     * Writes every buffered line to the file.
+     */
+    void flush() noexcept;
+
+    /**
+     * Returns whether the file is open.
+     */
+    [[nodiscard]] bool is_open() const noexcept;
+
+    /**
+     * Sets the metrics that the bytes written to the file are counted into, or nullptr to stop counting.
+     * Safe to call while other threads are logging.
+     * @param metrics The metrics, they must outlive this logger or be unset first.
+     */
+    void set_metrics(Metrics* metrics) noexcept;
+
+protected:
+    /**
+     * Formats a message into the current buffer, writing the batch if it is full.
+     * @param message The message to log.
+     */
+    void log_message_internal(const Message& message) const noexcept override;
+
+    /**
+     * Formats a record into the current buffer, writing the batch if it is full.
+     * @param record The record to log.
+     */
+    void log_record_internal(const Record& record) const noexcept override;
+
+    /**
+     * Copies the already formatted text of a message into the current buffer, writing the batch if it is full.
+     * @param message The message to log.
+     * @param cache The text of the message, formatted on first use.
+     */
+    void log_shared_message_internal(const Message& message, const RenderCache& cache) const noexcept override;
+
+    /**
+     * Copies the already formatted text of a record into the current buffer, writing the batch if it is full.
+     * @param record The record to log.
+     * @param cache The text of the record, formatted on first use.
+     */
+    void log_shared_record_internal(const Record& record, const RenderCache& cache) const noexcept override;
+
+    /**
+     * Writes the lines that are still buffered to the file, called by CrashHandler.
+     * @param writer Unused, the lines go to the file rather than the crash report.
+     */
+    void dump_pending_internal(util::SignalWriter& writer) const noexcept override;
+
+private:
+    struct Batch
+    {
+        std::vector<std::string> buffers;
+        // One per buffer, allocated up front so writing a batch never allocates.
+        std::vector<iovec> vectors;
+        std::size_t current = 0;
+        bool urgent         = false;
+    };
+
+    void append(const std::string& line, bool urgent) const noexcept;
+    void hand_off(std::unique_lock<std::mutex>& buffer_lock, bool force) const noexcept;
+    void write_batch(Batch& batch) const noexcept;
+    void rotate_if_needed(std::size_t incoming) const noexcept;
+    void rotate() const noexcept;
+    void open() const noexcept;
+
+    std::string m_path;
+    Options m_options;
+
+    mutable std::mutex m_buffer_mutex;
+    mutable Batch m_batches[2];
+    mutable std::size_t m_front = 0;
+    mutable std::chrono::steady_clock::time_point m_last_write;
+
+    mutable std::mutex m_io_mutex;
+    mutable int m_file                = -1;
+    mutable std::uint64_t m_file_size = 0;
+    std::atomic<Metrics*> m_metrics   = nullptr;
+    mutable std::chrono::system_clock::time_point m_opened_at;
+};
+} // isc
@@ -0,0 +1,107 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ISCLogs/Logger.hpp"
+#include "ISCLogs/Record.hpp"
+#include "ISCLogs/ThreadLocalSlots.hpp"
+
+namespace isc
+{
+/**
+ * A logger that keeps the messages its sink would have thrown away, so that they can be looked at once something fails.
+ * Messages the sink's threshold lets through are passed on as usual, the others are captured as records into a fixed
+ * size ring owned by the logging thread, overwriting the oldest ones. Capturing never allocates, text that does not fit
+ * in a record is truncated, and the ring is only locked by other threads while they dump it.
+ * When a failure is logged through the sink, the recent messages are logged through the sink first, regardless of its
+ * threshold, so the failure comes with the context that led up to it.
+ */
+class FlightRecorder
+        : public Logger
+{
+public:
+    struct Options
+    {
+        // The amount of messages each thread keeps, rounded up to a power of two.
+        std::size_t capacity = 256;
+        // Whether a failure dumps the recent messages of every thread, or only those of the thread that logged it.
+        bool dump_all_threads = false;
+    };
+
+    /**
+     * Constructs the recorder with the default options.
+     * The recorder accepts every severity by default, use set_severity to not record the lowest ones at all.
+     * @param sink The logger that messages are logged and dumped through, it must outlive this recorder.
+     */
+    explicit FlightRecorder(Logger& sink) noexcept;
+
+    /**
+     * Constructs the recorder.
+     * @param sink The logger that messages are logged and dumped through, it must outlive this recorder.
+     * @param options How many messages each thread keeps, and whose messages a failure dumps.
+     */
+    FlightRecorder(Logger& sink, const Options& options) noexcept;
+    ~FlightRecorder() noexcept override;
+
+    FlightRecorder(const FlightRecorder&)            = delete;
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+    /**
+     * Logs the recorded messages of every thread through the sink, ordered by the time they were captured, and forgets them.
+     */
+    void dump() const noexcept;
+
+protected:
+    /**
+     * Logs a message through the sink if its threshold lets it through, dumping the recent messages first if it is a failure.
+     * Otherwise the message is recorded.
+     * @param message The message to log.
+     */
+    void log_message_internal(const Message& message) const noexcept override;
+
+    /**
+     * Logs a record through the sink if its threshold lets it through, dumping the recent messages first if it is a failure.
+     * Otherwise a copy of the record is recorded.
+     * @param record The record to log.
+     */
+    void log_record_internal(const Record& record) const noexcept override;
+
+    /**
+     * Writes the recorded messages of every thread, called by CrashHandler. Records are written ring by ring.
+     * @param writer The writer to write the records to.
+     */
+    void dump_pending_internal(util::SignalWriter& writer) const noexcept override;
+
+private:
+    struct ThreadRing
+            : util::ThreadSlot
+    {
+        explicit ThreadRing(std::size_t capacity);
+
+        // Only contended while another thread dumps the ring.
+        mutable std::mutex mutex;
+        std::unique_ptr<Record[]> records;
+        std::size_t mask;
+        // Counts every record written to the ring, the oldest one still in it is at first.
+        std::uint64_t next  = 0;
+        std::uint64_t first = 0;
+    };
+
+    [[nodiscard]] ThreadRing* local_ring() const noexcept;
+    [[nodiscard]] static Record& claim(ThreadRing& ring) noexcept;
+    void dump_rings(bool all_threads) const noexcept;
+
+    Logger& m_sink;
+    Options m_options;
+    util::ThreadLocalSlots<ThreadRing> m_rings;
+};
+} // isc
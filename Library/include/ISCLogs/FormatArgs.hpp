@@ -0,0 +1,352 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <version>
+
+#if defined(__cpp_lib_format)
+#include <format>
+#endif
+
+#include "ISCLogs/NoThrowString.hpp"
+
+namespace isc::util
+{
+/**
+ * Checks the replacement fields of a format string, failing to compile if they do not fit the amount of arguments.
+ * @param format The format string.
+ * @param count The amount of arguments.
+ */
+consteval void check_fields(const std::string_view format, const std::size_t count)
+{
+    std::size_t next = 0;
+    bool automatic   = false;
+    bool manual      = false;
+
+    for (std::size_t i = 0; i < format.size(); ++i)
+    {
+        if (format[i] == '}')
+        {
+            if (i + 1 == format.size() || format[i + 1] != '}')
+                throw "A '}' in the format string is not escaped as '}}'";
+
+            ++i;
+            continue;
+        }
+
+        if (format[i] != '{')
+            continue;
+
+        if (i + 1 < format.size() && format[i + 1] == '{')
+        {
+            ++i;
+            continue;
+        }
+
+        std::size_t index = 0;
+        std::size_t end   = i + 1;
+        bool numbered     = false;
+        for (; end < format.size() && format[end] >= '0' && format[end] <= '9'; ++end)
+        {
+            index    = index * 10 + static_cast<std::size_t>(format[end] - '0');
+            numbered = true;
+        }
+
+        if (numbered)
+            manual = true;
+        else
+        {
+            index     = next++;
+            automatic = true;
+        }
+
+        if (automatic && manual)
+            throw "The format string mixes automatic and manual argument indices";
+        if (index >= count)
+            throw "The format string refers to more arguments than it is given";
+
+        for (; end < format.size() && format[end] != '}'; ++end)
+        {
+            if (format[end] == '{')
+                throw "Widths and precisions taken from arguments are not supported";
+        }
+
+        if (end == format.size())
+            throw "A replacement field of the format string is not closed";
+
+        i = end;
+    }
+}
+
+/**
+ * A compile time checked format string, along with the location of the code that it was written in.
+ * Its replacement fields are checked against the amount of arguments, and with std::format the specifications are
+ * checked against the types of the arguments too. Widths and precisions taken from arguments are not supported.
+ * @tparam Args The types of the arguments that will be formatted.
+ */
+template <typename... Args>
+struct FormatString
+{
+    template <typename T>
+        requires std::is_convertible_v<const T&, std::string_view>
+    consteval FormatString(const T& format, const std::source_location& location = std::source_location::current())
+        : string(format),
+          location(location)
+    {
+#if defined(__cpp_lib_format)
+        static_cast<void>(std::format_string<Args...>(format));
+#endif
+        check_fields(string, sizeof...(Args));
+    }
+
+    std::string_view string;
+    std::source_location location;
+};
+
+/**
+ * A format string along with a compact copy of its arguments, formatted only when the result is first needed.
+ * Arguments are encoded as a type tag followed by their value, strings are copied in, so capturing them costs
+ * little more than a memcpy and the encoded form can be formatted on another thread, or in another process.
+ */
+class FormatArgs
+{
+public:
+    static constexpr std::size_t inline_capacity = 96;
+    static constexpr std::size_t max_arguments   = 16;
+
+    enum class Type : std::uint8_t
+    {
+        Bool,
+        Char,
+        Int,
+        UInt,
+        Float,
+        Double,
+        Pointer,
+        String
+    };
+
+    /**
+     * Constructs an empty object, that holds no format string.
+     */
+    FormatArgs() noexcept = default;
+
+    /**
+     * Captures a format string and its arguments. Arguments must be arithmetic, pointers, or strings, at most max_arguments of them.
+     * If the arguments do not fit in the inline buffer, they are formatted immediately instead.
+     * @param format The format string, it is checked at compile time.
+     * @param args The arguments to format.
+     */
+    template <typename... Args>
+    FormatArgs(FormatString<std::type_identity_t<Args>...> format, Args&&... args) noexcept;
+
+    FormatArgs(const FormatArgs& args) noexcept;
+    FormatArgs& operator=(const FormatArgs& args) noexcept;
+
+    /**
+     * Rebuilds an object from a format string and its encoded arguments, as returned by arguments().
+     * @param format The format string, it must outlive the object.
+     * @param arguments The encoded arguments, truncated to the inline capacity.
+     */
+    [[nodiscard]] static FormatArgs from_encoded(std::string_view format, std::span<const std::byte> arguments) noexcept;
+
+    /**
+     * Returns whether the object holds no format string.
+     */
+    [[nodiscard]] bool empty() const noexcept;
+
+    /**
+     * Returns whether the result has already been formatted, in which case the arguments are no longer available.
+     */
+    [[nodiscard]] bool is_rendered() const noexcept;
+
+    /**
+     * Returns the format string.
+     */
+    [[nodiscard]] std::string_view format_string() const noexcept;
+
+    /**
+     * Returns the encoded arguments.
+     */
+    [[nodiscard]] std::span<const std::byte> arguments() const noexcept;
+
+    /**
+     * Returns the formatted result, formatting it on the first call. Safe to call from multiple threads.
+     */
+    [[nodiscard]] std::string_view rendered() const noexcept;
+
+    /**
+     * Formats a format string with encoded arguments, appending the result to a string.
+     * Without std::format, the standard format specifications are applied by a formatter of our own, which measures
+     * widths in bytes and ignores '#' for floating point arguments and 'L'.
+     * @param format The format string.
+     * @param arguments The encoded arguments.
+     * @param out The string to append to.
+     */
+    static void render(std::string_view format, std::span<const std::byte> arguments, std::string& out);
+
+private:
+    enum class State : std::uint8_t
+    {
+        Pending,
+        Rendering,
+        Rendered
+    };
+
+    template <typename T>
+    static consteval Type type_of() noexcept;
+
+    template <typename T>
+    static std::size_t encoded_size(const T& value) noexcept;
+
+    template <typename T>
+    static std::byte* encode(const T& value, std::byte* out) noexcept;
+
+    void write(const void* data, std::size_t size) noexcept;
+
+    std::string_view m_format;
+    std::uint32_t m_size = 0;
+    std::byte m_buffer[inline_capacity] = {};
+
+    mutable std::atomic<State> m_state = State::Pending;
+    mutable NoThrowString m_rendered;
+};
+
+template <typename... Args>
+FormatArgs::FormatArgs(FormatString<std::type_identity_t<Args>...> format, Args&&... args) noexcept
+    : m_format(format.string)
+{
+    static_assert(sizeof...(Args) <= max_arguments, "Too many arguments for a deferred format string");
+
+    const auto count       = static_cast<std::byte>(sizeof...(Args));
+    const std::size_t size = (1 + ... + encoded_size(args));
+    if (size <= inline_capacity)
+    {
+        m_buffer[0]    = count;
+        std::byte* out = m_buffer + 1;
+        ((out = encode(args, out)), ...);
+        m_size = static_cast<std::uint32_t>(size);
+        return;
+    }
+
+    try
+    {
+        std::string encoded(size, '\0');
+        std::byte* out = reinterpret_cast<std::byte*>(encoded.data());
+        *out++         = count;
+        ((out = encode(args, out)), ...);
+
+        std::string rendered;
+        render(m_format, std::as_bytes(std::span(encoded)), rendered);
+        m_rendered = rendered;
+    }
+    catch (...)
+    {
+        m_rendered = NoThrowString::from_static(m_format);
+    }
+
+    m_state.store(State::Rendered, std::memory_order_relaxed);
+}
+
+template <typename T>
+consteval FormatArgs::Type FormatArgs::type_of() noexcept
+{
+    using Decayed = std::remove_cvref_t<T>;
+
+    if constexpr (std::is_same_v<Decayed, bool>)
+        return Type::Bool;
+    else if constexpr (std::is_same_v<Decayed, char>)
+        return Type::Char;
+    else if constexpr (std::is_integral_v<Decayed> && std::is_signed_v<Decayed>)
+        return Type::Int;
+    else if constexpr (std::is_integral_v<Decayed>)
+        return Type::UInt;
+    else if constexpr (std::is_same_v<Decayed, float>)
+        return Type::Float;
+    else if constexpr (std::is_floating_point_v<Decayed>)
+        return Type::Double;
+    else if constexpr (std::is_null_pointer_v<Decayed>)
+        return Type::Pointer;
+    else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+        return Type::String;
+    else if constexpr (std::is_pointer_v<Decayed>)
+        return Type::Pointer;
+    else
+        static_assert(sizeof(T) == 0, "Deferred format arguments must be arithmetic, pointers, or strings");
+}
+
+template <typename T>
+std::size_t FormatArgs::encoded_size(const T& value) noexcept
+{
+    constexpr Type type = type_of<T>();
+
+    if constexpr (type == Type::Bool || type == Type::Char)
+        return 1 + 1;
+    else if constexpr (type == Type::Float)
+        return 1 + sizeof(float);
+    else if constexpr (type == Type::String)
+        return 1 + sizeof(std::uint32_t) + std::string_view(value).size();
+    else
+        return 1 + 8;
+}
+
+template <typename T>
+std::byte* FormatArgs::encode(const T& value, std::byte* out) noexcept
+{
+    constexpr Type type = type_of<T>();
+    *out++              = static_cast<std::byte>(type);
+
+    const auto copy = [&out](const void* data, const std::size_t size) {
+        std::memcpy(out, data, size);
+        out += size;
+    };
+
+    if constexpr (type == Type::Bool || type == Type::Char)
+    {
+        const char byte = static_cast<char>(value);
+        copy(&byte, 1);
+    }
+    else if constexpr (type == Type::Int)
+    {
+        const auto number = static_cast<std::int64_t>(value);
+        copy(&number, sizeof(number));
+    }
+    else if constexpr (type == Type::UInt)
+    {
+        const auto number = static_cast<std::uint64_t>(value);
+        copy(&number, sizeof(number));
+    }
+    else if constexpr (type == Type::Float)
+        copy(&value, sizeof(float));
+    else if constexpr (type == Type::Double)
+    {
+        const auto number = static_cast<double>(value);
+        copy(&number, sizeof(number));
+    }
+    else if constexpr (type == Type::String)
+    {
+        const std::string_view string(value);
+        const auto size = static_cast<std::uint32_t>(string.size());
+        copy(&size, sizeof(size));
+        copy(string.data(), string.size());
+    }
+    else
+    {
+        const auto address = reinterpret_cast<std::uint64_t>(static_cast<const void*>(value));
+        copy(&address, sizeof(address));
+    }
+
+    return out;
+}
+} // isc::util
@@ -4,6 +4,40 @@
 
 #pragma once
 
+#include "ISCLogs/Clock.hpp"
+#include "ISCLogs/TimestampFormatter.hpp"
+#include "ISCLogs/ThreadLocalSlots.hpp"
+#include "ISCLogs/MemoryPool.hpp"
 #include "ISCLogs/NoThrowString.hpp"
+#include "ISCLogs/InternTable.hpp"
+#include "ISCLogs/TraceChain.hpp"
+#include "ISCLogs/FormatArgs.hpp"
+#include "ISCLogs/Escape.hpp"
+#include "ISCLogs/Fields.hpp"
 #include "ISCLogs/Message.hpp"
+#include "ISCLogs/Record.hpp"
 #include "ISCLogs/Logger.hpp"
+#include "ISCLogs/Macros.hpp"
+#include "ISCLogs/CodeRegistry.hpp"
+#include "ISCLogs/AsyncLogger.hpp"
+#include "ISCLogs/Coroutine.hpp"
+#include "ISCLogs/StagingLogger.hpp"
+#include "ISCLogs/RateLimiter.hpp"
+#include "ISCLogs/FlightRecorder.hpp"
+#include "ISCLogs/Metrics.hpp"
+#include "ISCLogs/MetricsLogger.hpp"
+#include "ISCLogs/RenderCache.hpp"
+#include "ISCLogs/MultiLogger.hpp"
+#include "ISCLogs/LoggerRegistry.hpp"
+#include "ISCLogs/Encoder.hpp"
+#include "ISCLogs/SignalWriter.hpp"
+#include "ISCLogs/CrashHandler.hpp"
+
+#if !defined(_WIN32)
+#include "ISCLogs/FileLogger.hpp"
+#include "ISCLogs/BinaryLogger.hpp"
+#endif
+
+#if defined(__linux__)
+#include "ISCLogs/ConfigWatcher.hpp"
+#endif
@@ -0,0 +1,115 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+
+#include "ISCLogs/NoThrowString.hpp"
+
+namespace isc::util
+{
+/**
+ * A process-wide table that maps strings to stable 32-bit ids, so that messages and sinks can pass ids around instead of strings.
+ * Looking strings and ids up never locks, only adding a string does. Strings are never removed, and ids start at 1,
+ * with 0 meaning that the string could not be added because the table is full.
+ */
+class InternTable
+{
+public:
+    static constexpr std::uint32_t no_id     = 0;
+    static constexpr std::size_t max_strings = 1 << 13;
+
+    /**
+     * Returns the table shared by the whole process.
+     */
+    [[nodiscard]] static InternTable& global() noexcept;
+
+    InternTable() noexcept;
+    ~InternTable() noexcept;
+
+    InternTable(const InternTable&)            = delete;
+    InternTable& operator=(const InternTable&) = delete;
+
+    /**
+     * Returns the id of a string, adding a copy of it to the table if it is not in it yet.
+     * @param string The string to intern.
+     * @return The id of the string, or no_id if the table is full.
+     */
+    std::uint32_t intern(std::string_view string) noexcept;
+
+    /**
+     * Returns the id of a null terminated string with static lifetime, such as the file name of a std::source_location.
+     * The string's address is remembered, so that later calls with the same address skip hashing the string.
+     * Addresses stop being remembered once as many have been as the table has room for strings, twice over.
+     * @param string The string to intern.
+     * @return The id of the string, or no_id if the table is full.
+     */
+    std::uint32_t intern_static(const char* string) noexcept;
+
+    /**
+     * Returns the id of a string without adding it to the table.
+     * @param string The string to look for.
+     * @return The id of the string, or no_id if it is not in the table.
+     */
+    [[nodiscard]] std::uint32_t find(std::string_view string) const noexcept;
+
+    /**
+     * Returns the string with the given id, or an empty string if there is none.
+     * The string is valid for as long as the table is.
+     * @param id The id of the string.
+     */
+    [[nodiscard]] std::string_view lookup(std::uint32_t id) const noexcept;
+
+    /**
+     * Returns the amount of strings in the table.
+     */
+    [[nodiscard]] std::size_t size() const noexcept;
+
+private:
+    struct Entry
+    {
+        const char* data;
+        std::size_t size;
+    };
+
+    struct StaticSlot
+    {
+        std::atomic<const char*> key;
+        std::atomic<std::uint32_t> id;
+    };
+
+    static constexpr std::size_t s_slot_count = max_strings * 2;
+    static constexpr std::size_t s_block_size = 64 * 1024;
+
+    [[nodiscard]] static std::uint64_t hash(std::string_view string) noexcept;
+    [[nodiscard]] std::uint32_t find(std::string_view string, std::uint64_t hash) const noexcept;
+    [[nodiscard]] const char* store(std::string_view string) noexcept;
+
+    // Each slot holds the top half of a string's hash in its upper 32 bits, and the string's id in the lower ones.
+    std::atomic<std::uint64_t>* m_slots = nullptr;
+    StaticSlot* m_static_slots          = nullptr;
+    Entry* m_entries                    = nullptr;
+    std::atomic<std::uint32_t> m_size   = 0;
+
+    std::mutex m_mutex;
+    char* m_block            = nullptr;
+    std::size_t m_block_size = 0;
+    std::size_t m_block_used = 0;
+};
+} // isc::util
+
+/**
+ * Interns a constant string once per call site, and returns it as a NoThrowString that carries its id.
+ * @param string The string to intern, it must be usable in a constant expression, e.g. a string literal.
+ */
+#define ISC_INTERN(string)                                                                                             \
+    ([]() noexcept -> const ::isc::util::NoThrowString& {                                                              \
+        static const ::isc::util::NoThrowString isc_interned_ = ::isc::util::NoThrowString::interned(string);          \
+        return isc_interned_;                                                                                          \
+    }())
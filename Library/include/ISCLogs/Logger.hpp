@@ -3,10 +3,20 @@
 //
 
 #pragma once
+#include <atomic>
+
 #include "Message.hpp"
+#include "Record.hpp"
 
 namespace isc
 {
+class RenderCache;
+
+namespace util
+{
+class SignalWriter;
+}
+
 /**
  * Base class for a logger capable of logging messages above a certain severity threshold.
  */
@@ -30,11 +40,48 @@ public:
      */
     void log_message(const Message& message) const noexcept;
 
+    /**
+     * Logs a message whose description is formatted from the given arguments, if it is above the logger's threshold.
+     * The message is only built once the threshold has been checked, and the description is only formatted by the sink.
+     * @param severity The severity of the message.
+     * @param code The numerical code of the message.
+     * @param name The name of the message.
+     * @param description The format string of the description, along with the location in the code that the message was generated from.
+     * @param args The arguments of the description, they must be arithmetic, pointers, or strings.
+     */
+    template <typename... Args>
+    void log_message(
+        Message::Severity severity,
+        unsigned int code,
+        util::NoThrowString name,
+        util::FormatString<std::type_identity_t<Args>...> description,
+        Args&&... args
+    ) const noexcept;
+
+    /**
+     * Logs a record if it is above the logger's threshold.
+     * The record is not released, that is left to whoever owns it.
+     * @param record The record to log.
+     */
+    void log_record(const Record& record) const noexcept;
+
+    /**
+     * Returns whether a message of the given severity would be logged, so the message can be skipped before being built.
+     * @param severity The severity of the message.
+     */
+    [[nodiscard]] bool should_log(Message::Severity severity) const noexcept;
+
     /**
      * Sets the severity threshold that the logger will use.
+     * The threshold is atomic, so it can be changed while other threads are logging, and from signal handlers.
      * @param severity The severity above which a message will be logged.
      */
     void set_severity(const Message::Severity& severity) noexcept;
+
+    /**
+     * Returns the severity threshold that the logger currently uses.
+     */
+    [[nodiscard]] Message::Severity severity() const noexcept;
 protected:
     /**
      * Actually logs a message.
@@ -42,7 +89,88 @@ protected:
      */
     virtual void log_message_internal(const Message& message) const noexcept = 0;
 
+    /**
+     * Actually logs a record, by default it is converted back into a message and passed to log_message_internal.
+     * Loggers that can consume records directly should override this to avoid the conversion.
+     * @param record The record to log.
+     */
+    virtual void log_record_internal(const Record& record) const noexcept;
+
+    /**
+     * Actually logs a message that a MultiLogger is passing to several loggers, along with its text shared between them.
+     * By default the text is ignored and the message is passed to log_message_internal.
+     * Loggers that log the message's text should override this to avoid formatting it again.
+     * @param message The message to log.
+     * @param cache The text of the message, formatted on first use.
+     */
+    virtual void log_shared_message_internal(const Message& message, const RenderCache& cache) const noexcept;
+
+    /**
+     * Actually logs a record that a MultiLogger is passing to several loggers, along with its text shared between them.
+     * By default the text is ignored and the record is passed to log_record_internal.
+     * @param record The record to log.
+     * @param cache The text of the record, formatted on first use.
+     */
+    virtual void log_shared_record_internal(const Record& record, const RenderCache& cache) const noexcept;
+
+    /**
+     * Writes out whatever the logger is holding on to and has not passed on yet, called by CrashHandler from a signal handler.
+     * Overrides must be async-signal-safe: they must not allocate, and must not wait on a lock another thread could hold.
+     * By default the logger holds nothing, so nothing is written.
+     * @param writer The writer to write pending records to.
+     */
+    virtual void dump_pending_internal(util::SignalWriter& writer) const noexcept;
+
 private:
-    Message::Severity m_threshold = Message::Severity::Nominal;
+    friend class CrashHandler;
+    friend class FlightRecorder;
+    friend class MultiLogger;
+
+    // Relaxed is enough, a threshold change only has to become visible eventually, and guards no other data.
+    std::atomic<Message::Severity> m_threshold = Message::Severity::Nominal;
 };
+
+constexpr Logger::Logger(const Message::Severity threshold) noexcept
+    : m_threshold(threshold)
+{}
+
+inline void Logger::log_message(const Message& message) const noexcept
+{
+    if (should_log(message.severity()))
+        log_message_internal(message);
+}
+
+inline void Logger::log_record(const Record& record) const noexcept
+{
+    if (should_log(record.severity()))
+        log_record_internal(record);
+}
+
+inline bool Logger::should_log(const Message::Severity severity) const noexcept
+{
+    return severity >= m_threshold.load(std::memory_order_relaxed);
+}
+
+inline void Logger::set_severity(const Message::Severity& severity) noexcept
+{
+    m_threshold.store(severity, std::memory_order_relaxed);
+}
+
+inline Message::Severity Logger::severity() const noexcept
+{
+    return m_threshold.load(std::memory_order_relaxed);
+}
+
+template <typename... Args>
+void Logger::log_message(
+    const Message::Severity severity,
+    const unsigned int code,
+    util::NoThrowString name,
+    util::FormatString<std::type_identity_t<Args>...> description,
+    Args&&... args
+) const noexcept
+{
+    if (should_log(severity))
+        log_message_internal(Message(code, std::move(name), severity, description, std::forward<Args>(args)...));
+}
 } // isc
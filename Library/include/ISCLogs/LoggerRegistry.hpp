@@ -0,0 +1,133 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include "ISCLogs/Logger.hpp"
+
+namespace isc
+{
+/**
+ * A fixed size table of named loggers, whose thresholds can be changed at runtime, e.g. from a config file or a signal.
+ * Changing thresholds never locks, so it is safe from signal handlers and never pauses threads that are logging.
+ * Only adding and removing loggers lock, and a logger must be removed before it is destroyed. Removing a logger waits
+ * for the thresholds being changed through the registry to be, so it can be destroyed as soon as remove returns.
+ */
+class LoggerRegistry
+{
+public:
+    static constexpr std::size_t max_loggers   = 64;
+    static constexpr std::size_t name_capacity = 47;
+
+    /**
+     * Returns the registry shared by the whole process.
+     */
+    [[nodiscard]] static LoggerRegistry& global() noexcept;
+
+    LoggerRegistry() noexcept = default;
+
+    LoggerRegistry(const LoggerRegistry&)            = delete;
+    LoggerRegistry& operator=(const LoggerRegistry&) = delete;
+
+    /**
+     * Adds a logger under a name, replacing the logger already registered under it.
+     * @param name The name of the logger, at most name_capacity characters.
+     * @param logger The logger, it must be removed from the registry before it is destroyed.
+     * @return Whether the logger was added, false if the name is too long or the registry is full.
+     */
+    bool add(std::string_view name, Logger& logger) noexcept;
+
+    /**
+     * Removes a logger from the registry, if it is in it, once no other thread is changing its threshold through the registry.
+     * Must not be called from a signal handler.
+     * @param logger The logger to remove.
+     */
+    void remove(const Logger& logger) noexcept;
+
+    /**
+     * Returns the logger registered under a name, or nullptr if there is none.
+     * Unlike the thresholds changed through the registry, the logger is not kept from being removed and destroyed
+     * while it is used, so the caller has to know that it outlives its use.
+     * @param name The name of the logger.
+     */
+    [[nodiscard]] Logger* find(std::string_view name) const noexcept;
+
+    /**
+     * Sets the threshold of the logger registered under a name.
+     * @param name The name of the logger, or "*" for every logger.
+     * @param severity The new threshold.
+     * @return Whether a logger was found.
+     */
+    bool set_severity(std::string_view name, Message::Severity severity) noexcept;
+
+    /**
+     * Applies a config, made of lines of the form "name = Severity". Blank lines and lines starting with # are ignored,
+     * and "*" as a name applies to every logger. Lines that cannot be parsed or name unknown loggers are skipped.
+     * @param config The contents of the config.
+     * @return The amount of lines that were applied.
+     */
+    std::size_t apply(std::string_view config) noexcept;
+
+    /**
+     * Reads a config file and applies it, see apply.
+     * @param path The path of the config file.
+     * @return Whether the file could be read.
+     */
+    bool load(const std::string& path) noexcept;
+
+    /**
+     * Lowers every logger's threshold to Debug, remembering the previous thresholds. Safe to call from a signal handler.
+     */
+    void enable_debug() noexcept;
+
+    /**
+     * Restores the thresholds remembered by the last enable_debug call. Safe to call from a signal handler.
+     */
+    void restore() noexcept;
+
+#if !defined(_WIN32)
+    /**
+     * Installs signal handlers that call enable_debug and restore on the global registry.
+     * @param debug_signal The signal that lowers every threshold to Debug.
+     * @param restore_signal The signal that restores the previous thresholds.
+     * @return Whether both handlers were installed.
+     */
+    static bool install_signal_handlers(int debug_signal, int restore_signal) noexcept;
+#endif
+
+private:
+    struct Entry
+    {
+        char name[name_capacity + 1]         = {};
+        std::uint8_t name_size               = 0;
+        std::atomic<Logger*> logger          = nullptr;
+        std::atomic<Message::Severity> saved = Message::Severity::Nominal;
+        std::atomic<bool> debugging          = false;
+        // The threads using the logger, which remove waits for after taking the logger out.
+        std::atomic<std::uint32_t> readers   = 0;
+    };
+
+    // Returns the index of the entry with the given name, or max_loggers if there is none.
+    [[nodiscard]] std::size_t index_of(std::string_view name) const noexcept;
+
+    // Calls a function with the logger of an entry, if it has one, and returns whether it had.
+    template <typename Function>
+    static bool visit(Entry& entry, Function&& function) noexcept;
+
+    // Takes the logger out of an entry, and waits for the threads still using it.
+    static void release(Entry& entry, Logger* logger) noexcept;
+
+    // Entries are only ever appended, and published by bumping the count, so readers never lock.
+    Entry m_entries[max_loggers];
+    std::atomic<std::size_t> m_size = 0;
+    std::mutex m_mutex;
+};
+} // isc
@@ -0,0 +1,39 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include "ISCLogs/Logger.hpp"
+
+// The index of the lowest severity that ISC_LOG calls are compiled in for, set through the ISCLOGS_MIN_SEVERITY CMake option.
+#ifndef ISCLOGS_MIN_SEVERITY
+#define ISCLOGS_MIN_SEVERITY 0
+#endif
+
+namespace isc
+{
+/**
+ * The lowest severity that ISC_LOG calls are compiled in for, anything below it is removed at compile time.
+ */
+inline constexpr Message::Severity compiled_min_severity = static_cast<Message::Severity>(ISCLOGS_MIN_SEVERITY);
+} // isc
+
+/**
+ * Logs a message through a logger, without building the message unless it is going to be logged.
+ * Calls below compiled_min_severity compile to nothing, and the others check the logger's threshold
+ * before any of the message's arguments are evaluated.
+ * @param logger The logger to log the message through.
+ * @param severity The name of the severity of the message, e.g. Warning.
+ * @param ... The code, name and optionally the description of the message.
+ */
+#define ISC_LOG(logger, severity, ...)                                                                                 \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if constexpr (::isc::Message::Severity::severity >= ::isc::compiled_min_severity)                              \
+        {                                                                                                              \
+            const ::isc::Logger& isc_log_logger_ = (logger);                                                           \
+            if (isc_log_logger_.should_log(::isc::Message::Severity::severity))                                        \
+                isc_log_logger_.log_message(::isc::Message(__VA_ARGS__, ::isc::Message::Severity::severity));          \
+        }                                                                                                              \
+    } while (false)
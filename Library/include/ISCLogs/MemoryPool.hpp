@@ -0,0 +1,115 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+#include "ISCLogs/ThreadLocalSlots.hpp"
+
+namespace isc::util
+{
+/**
+ * A pool of small blocks for the payloads of messages, e.g. long NoThrowString and TraceChain blocks.
+ * Blocks are sorted into size classes, and every thread allocates from and frees to its own free lists without any atomics.
+ * A block freed by another thread is pushed onto its owner's lock-free return stack, and taken back in one go once the
+ * owner runs out of blocks of that size. Blocks are carved out of large slabs, which are only freed with the pool.
+ * Blocks larger than max_block_size, or more aligned than block_alignment, come from the global heap.
+ * It is also a std::pmr::memory_resource, so it can back standard containers.
+ */
+class MemoryPool
+        : public std::pmr::memory_resource
+{
+public:
+    static constexpr std::size_t block_alignment = 16;
+    static constexpr std::size_t min_block_size  = 32;
+    static constexpr std::size_t max_block_size  = 4096;
+    static constexpr std::size_t slab_size       = 64 * 1024;
+
+    MemoryPool() noexcept;
+
+    /**
+     * Every block allocated from the pool must have been freed by then.
+     * The slabs of threads that have exited are freed now, the others are freed as their threads exit.
+     */
+    ~MemoryPool() noexcept override;
+
+    MemoryPool(const MemoryPool&)            = delete;
+    MemoryPool& operator=(const MemoryPool&) = delete;
+
+    /**
+     * Returns the pool shared by the whole process, which is never destroyed.
+     */
+    [[nodiscard]] static MemoryPool& global() noexcept;
+
+    /**
+     * Allocates a block of at least the given size, aligned to block_alignment.
+     * @param size The size of the block.
+     * @return The block, or nullptr if memory is exhausted.
+     */
+    [[nodiscard]] void* allocate_block(std::size_t size) noexcept;
+
+    /**
+     * Frees a block allocated by allocate_block of any pool, from any thread.
+     * @param block The block to free, may be nullptr.
+     */
+    static void deallocate_block(void* block) noexcept;
+
+    /**
+     * Returns the amount of bytes of slabs that the pool has reserved from the heap.
+     */
+    [[nodiscard]] std::size_t reserved() const noexcept;
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+    static constexpr std::size_t s_class_count = 8; // 32 to 4096 bytes, in powers of two.
+
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    struct ThreadCache
+            : ThreadSlot
+    {
+        ~ThreadCache() noexcept;
+
+        MemoryPool* pool = nullptr;
+
+        // Only touched by the owner.
+        FreeBlock* local[s_class_count] = {};
+        char* bump                      = nullptr;
+        char* bump_end                  = nullptr;
+        // Each slab starts with a pointer to the slab reserved before it.
+        void* slabs                     = nullptr;
+
+        // Pushed to by other threads, taken whole by the owner.
+        alignas(64) std::atomic<FreeBlock*> returned[s_class_count] = {};
+    };
+
+    struct Header
+    {
+        ThreadCache* cache; // nullptr if the block came from the global heap.
+        std::size_t size_class;
+    };
+
+    static_assert(sizeof(Header) <= block_alignment, "The header must not change the alignment of blocks");
+
+    [[nodiscard]] ThreadCache* local_cache() noexcept;
+    [[nodiscard]] static void* refill(ThreadCache& cache, std::size_t size_class) noexcept;
+
+    ThreadLocalSlots<ThreadCache> m_caches;
+    std::atomic<std::size_t> m_reserved = 0;
+};
+} // isc::util
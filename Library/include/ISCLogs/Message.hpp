@@ -4,15 +4,26 @@
 
 #pragma once
 
-#include <list>
+#include <atomic>
+#include <cstdint>
+#include <optional>
 #include <source_location>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <utility>
 
+#include "ISCLogs/Clock.hpp"
+#include "ISCLogs/Fields.hpp"
+#include "ISCLogs/FormatArgs.hpp"
+#include "ISCLogs/MemoryPool.hpp"
 #include "ISCLogs/NoThrowString.hpp"
+#include "ISCLogs/TraceChain.hpp"
 
 namespace isc
 {
+struct CodeInfo;
+
 /**
  * @brief The Message class is used to convey information about a problem encountered during runtime.
  */
@@ -37,6 +48,12 @@ public:
     Message();
     ~Message() override;
 
+    Message(const Message& message) noexcept;
+    Message& operator=(const Message& message) noexcept;
+
+    Message(Message&& message) noexcept;
+    Message& operator=(Message&& message) noexcept;
+
     /**
      * Constructs a message object with the given parameters.
      * @param code The numerical code of the message.
@@ -68,15 +85,124 @@ public:
     );
 
     /**
-     * Returns the contents of the message
+     * Constructs a message object whose description is formatted from already captured arguments.
+     * @param code The numerical code of the message.
+     * @param name The name of the message, usually what is used as the title of a message box.
+     * @param description The format string of the description and its arguments.
+     * @param severity The severity of the message.
+     * @param location The location in the code that the error occurred in.
+    */
+    Message(
+        unsigned int code,
+        util::NoThrowString name,
+        util::FormatArgs description,
+        Severity severity,
+        const std::source_location& location = std::source_location::current()
+    );
+
+    /**
+     * Constructs a message object whose name, description, trace and text all take their heap storage from a pool.
+     * Messages that are created, logged and destroyed at a high rate then rarely reach the global heap.
+     * @param pool The pool to allocate from, it must outlive the message and its copies.
+     * @param code The numerical code of the message.
+     * @param name The name of the message, usually what is used as the title of a message box.
+     * @param description The description of what happened, usually what is used as the contents of a message box.
+     * @param severity The severity of the message.
+     * @param location The location in the code that the error occurred in.
+    */
+    Message(
+        util::MemoryPool& pool,
+        unsigned int code,
+        std::string_view name,
+        std::string_view description,
+        Severity severity,
+        const std::source_location& location = std::source_location::current()
+    );
+
+    /**
+     * Constructs a message object whose name, trace and text take their heap storage from a pool, but without a description.
+     * @param pool The pool to allocate from, it must outlive the message and its copies.
+     * @param code The numerical code of the message.
+     * @param name The name of the message, usually what is used as the title of a message box.
+     * @param severity The severity of the message.
+     * @param location The location in the code that the error occurred in.
+    */
+    Message(
+        util::MemoryPool& pool,
+        unsigned int code,
+        std::string_view name,
+        Severity severity,
+        const std::source_location& location = std::source_location::current()
+    );
+
+    /**
+     * Constructs a message object from a code registered in a CodeRegistry, see CodeRegistry.
+     * The name and description are referenced instead of copied, so the message never allocates.
+     * @param info The registered code, whose name and description must outlive the message and its copies, e.g. string literals.
+     * @param location The location in the code that the error occurred in.
+    */
+    explicit Message(const CodeInfo& info, const std::source_location& location = std::source_location::current()) noexcept;
+
+    /**
+     * Constructs a message object from a code registered in a CodeRegistry, with a description of its own.
+     * @param info The registered code, whose name and description must outlive the message and its copies, e.g. string literals.
+     * @param description The description of what happened, replacing the one registered with the code.
+     * @param location The location in the code that the error occurred in.
+    */
+    Message(
+        const CodeInfo& info,
+        util::NoThrowString description,
+        const std::source_location& location = std::source_location::current()
+    ) noexcept;
+
+    /**
+     * Constructs a message object whose description is formatted from the given arguments, only once it is needed.
+     * @param code The numerical code of the message.
+     * @param name The name of the message, usually what is used as the title of a message box.
+     * @param severity The severity of the message.
+     * @param description The format string of the description, along with the location in the code that the error occurred in.
+     * @param args The arguments of the description, they must be arithmetic, pointers, or strings.
+    */
+    template <typename... Args>
+    Message(
+        unsigned int code,
+        util::NoThrowString name,
+        Severity severity,
+        util::FormatString<std::type_identity_t<Args>...> description,
+        Args&&... args
+    );
+
+    /**
+     * Returns the contents of the message, formatted like message().
+     * The text is formatted on the first call and kept by the message, later calls and copies of the message reuse it.
+     * Safe to call from multiple threads.
      */
-    char const* what() const override;
+    char const* what() const noexcept override;
 
     /**
      * Returns a string containing the information contained in the message.
      */
     [[nodiscard]] std::string message() const;
 
+    /**
+     * Appends the information contained in the message to a string, formatted like message().
+     * @param out The string to append to.
+     */
+    void format_to(std::string& out) const;
+
+    /**
+     * Returns the name of a severity, e.g. "Warning".
+     * @param severity The severity to name.
+     */
+    [[nodiscard]] static constexpr std::string_view severity_name(Severity severity) noexcept;
+
+    /**
+     * Returns the severity with the given name, ignoring case, e.g. "warning" for Warning.
+     * @param name The name of the severity.
+     * @return The severity, or nothing if no severity has that name.
+     */
+    [[nodiscard]] static std::optional<Severity> parse_severity(std::string_view name) noexcept;
+
     /**
      * Returns whether the message is considered a failure, e.g. its severity is Error or higher.
      */
@@ -87,12 +213,43 @@ public:
      * @param message The message to add at the end of the trace
      * @return The message object for monadic call chains.
      */
-    Message add_trace(const std::string& message) noexcept;
+    Message& add_trace(std::string_view message) & noexcept;
+
+    /**
+     * Adds a trace to a temporary message, used to generate a stacktrace of where an error occurred.
+     * @param message The message to add at the end of the trace
+     * @return The message, moved out of the temporary, for monadic call chains.
+     */
+    Message add_trace(std::string_view message) && noexcept;
 
     /**
      * Returns the stacktrace currently held by the message.
      */
-    const std::list<std::string>& get_trace() const noexcept;
+    const util::TraceChain& get_trace() const noexcept;
+
+    /**
+     * Attaches a typed key-value field to the message, e.g. a request id or a latency, so that it does not have to be
+     * embedded in the description and parsed back out of it.
+     * @param key The key of the field.
+     * @param value The value of the field, a boolean, a number, or a string.
+     * @return The message object for monadic call chains.
+     */
+    template <typename T>
+    Message& add_field(std::string_view key, const T& value) & noexcept;
+
+    /**
+     * Attaches a typed key-value field to a temporary message.
+     * @param key The key of the field.
+     * @param value The value of the field, a boolean, a number, or a string.
+     * @return The message, moved out of the temporary, for monadic call chains.
+     */
+    template <typename T>
+    Message add_field(std::string_view key, const T& value) && noexcept;
+
+    /**
+     * Returns the fields attached to the message.
+     */
+    [[nodiscard]] const util::Fields& fields() const noexcept;
 
     /**
      * Returns the numerical code of the message.
@@ -109,11 +266,22 @@ public:
      */
     [[nodiscard]] std::string_view name() const noexcept;
 
+    /**
+     * Returns the id of the message's name in the global util::InternTable, or 0 if the name is not interned.
+     */
+    [[nodiscard]] std::uint32_t name_id() const noexcept;
+
     /**
      * Returns the description of the message, or a default description if none was given to the message.
+     * A formatted description is formatted on the first call.
      */
     [[nodiscard]] std::string_view description() const noexcept;
 
+    /**
+     * Returns the format string and arguments of the description, empty if the description is not formatted.
+     */
+    [[nodiscard]] const util::FormatArgs& format_args() const noexcept;
+
     /**
      * Returns the severity of the message.
      */
@@ -139,29 +307,122 @@ public:
      */
     [[nodiscard]] std::string_view function(const std::string& relative_to = "") const noexcept;
 
+    /**
+     * Returns the location in the code that the message was generated from.
+     */
+    [[nodiscard]] const std::source_location& location() const noexcept;
+
+    /**
+     * Returns the time the message was constructed at, in nanoseconds since the Unix epoch, as read from isc::Clock.
+     */
+    [[nodiscard]] std::uint64_t timestamp() const noexcept;
+
     /**
      * Promotes the severity to _at least_ the given severity. If the message is already that severity or higher, nothing is done.
      * @param severity The severity to promote to.
      * @return The message objet for monadic call chains.
      */
-    Message promote(const Severity& severity) noexcept;
+    Message& promote(const Severity& severity) & noexcept;
+
+    /**
+     * Promotes the severity of a temporary message to _at least_ the given severity. If the message is already that severity or higher, nothing is done.
+     * @param severity The severity to promote to.
+     * @return The message, moved out of the temporary, for monadic call chains.
+     */
+    Message promote(const Severity& severity) && noexcept;
 
 private:
+    // Records restore the timestamp of the message they were captured from.
+    friend class Record;
+
+    /**
+     * Holds the text returned by what(), shared by copies of the message once it has been formatted.
+     */
+    class WhatCache
+    {
+    public:
+        WhatCache() noexcept = default;
+
+        WhatCache(const WhatCache& cache) noexcept;
+        WhatCache& operator=(const WhatCache& cache) noexcept;
+
+        /**
+         * Returns the text of a message, formatting it on the first call.
+         * @param message The message that owns the cache.
+         */
+        [[nodiscard]] const char* get(const Message& message) const noexcept;
+
+        /**
+         * Forgets the text, for when the message changes.
+         */
+        void reset() noexcept;
+
+    private:
+        enum class State : std::uint8_t
+        {
+            Pending,
+            Rendering,
+            Rendered
+        };
+
+        mutable std::atomic<State> m_state = State::Pending;
+        mutable util::NoThrowString m_text;
+    };
+
     unsigned int m_code               = 0;
-    util::NoThrowString m_name        = "Default Name";
+    util::NoThrowString m_name        = util::NoThrowString::from_static("Default Name");
     bool m_has_description            = true;
-    util::NoThrowString m_description = "Default Description";
+    util::NoThrowString m_description = util::NoThrowString::from_static("Default Description");
+    util::FormatArgs m_format;
     Severity m_severity               = Severity::Nominal;
     std::source_location m_source_location;
+    std::uint64_t m_timestamp         = Clock::now();
 
-    std::list<std::string> m_trace;
-    mutable char* m_temp_string;
+    // The pool that the trace and the text returned by what() are allocated from, or nullptr for the global heap.
+    util::MemoryPool* m_pool          = nullptr;
+    util::TraceChain m_trace;
+    util::Fields m_fields;
+    WhatCache m_what;
 };
 
-class NominalMessage
+/**
+ * The base of the messages of a single severity, e.g. ErrorMessage, which gives them the constructor taking a format string.
+ * @tparam S The severity of the messages.
+ */
+template <Message::Severity S>
+class SeverityMessage
         : public Message
 {
 public:
+    /**
+     * Constructs a message object whose description is formatted from the given arguments only once it is needed.
+     * @param code The numerical code of the message.
+     * @param name The name of the message, usually what is used as the title of a message box.
+     * @param description The format string of the description, along with the location in the code that the error occurred in.
+     * @param args The arguments of the description, they must be arithmetic, pointers, or strings.
+    */
+    template <typename... Args>
+    SeverityMessage(
+        unsigned int code,
+        util::NoThrowString name,
+        util::FormatString<std::type_identity_t<Args>...> description,
+        Args&&... args
+    );
+
+protected:
+    /**
+     * Forwards the arguments to a constructor of Message, for the constructors of the messages of each severity.
+     */
+    template <typename... Args>
+    explicit SeverityMessage(std::in_place_t, Args&&... args);
+};
+
+class NominalMessage
+        : public SeverityMessage<Message::Severity::Nominal>
+{
+public:
+    using SeverityMessage::SeverityMessage;
+
     /**
      * Constructs a message object with the given parameters and a severity of nominal.
      * @param code The numerical code of the message.
@@ -190,9 +451,11 @@ public:
 };
 
 class DebugMessage
-        : public Message
+        : public SeverityMessage<Message::Severity::Debug>
 {
 public:
+    using SeverityMessage::SeverityMessage;
+
     /**
      * Constructs a message object with the given parameters and a severity of debug.
      * @param code The numerical code of the message.
@@ -221,9 +484,11 @@ public:
 };
 
 class NoticeMessage
-        : public Message
+        : public SeverityMessage<Message::Severity::Notice>
 {
 public:
+    using SeverityMessage::SeverityMessage;
+
     /**
      * Constructs a message object with the given parameters and a severity of notice.
      * @param code The numerical code of the message.
@@ -252,9 +517,11 @@ public:
 };
 
 class WarningMessage
-        : public Message
+        : public SeverityMessage<Message::Severity::Warning>
 {
 public:
+    using SeverityMessage::SeverityMessage;
+
     /**
      * Constructs a message object with the given parameters and a severity of warning.
      * @param code The numerical code of the message.
@@ -283,9 +550,11 @@ public:
 };
 
 class ErrorMessage
-        : public Message
+        : public SeverityMessage<Message::Severity::Error>
 {
 public:
+    using SeverityMessage::SeverityMessage;
+
     /**
      * Constructs a message object with the given parameters and a severity of error.
      * @param code The numerical code of the message.
@@ -314,9 +583,11 @@ public:
 };
 
 class FatalMessage
-        : public Message
+        : public SeverityMessage<Message::Severity::Fatal>
 {
 public:
+    using SeverityMessage::SeverityMessage;
+
     /**
      * Constructs a message object with the given parameters and a severity of fatal.
      * @param code The numerical code of the message.
@@ -343,4 +614,139 @@ public:
         const std::source_location& location = std::source_location::current()
     );
 };
+
+constexpr std::string_view Message::severity_name(const Severity severity) noexcept
+{
+    switch (severity)
+    {
+    case Severity::Debug:
+        return "Debug";
+    case Severity::Nominal:
+        return "Nominal";
+    case Severity::Notice:
+        return "Notice";
+    case Severity::Warning:
+        return "Warning";
+    case Severity::Error:
+        return "Error";
+    case Severity::Fatal:
+        return "Fatal";
+    }
+
+    return "Unknown";
+}
+
+inline bool Message::is_failure() const noexcept
+{
+    return m_severity >= Severity::Error;
+}
+
+inline const util::TraceChain& Message::get_trace() const noexcept
+{
+    return m_trace;
+}
+
+inline const util::Fields& Message::fields() const noexcept
+{
+    return m_fields;
+}
+
+inline unsigned int Message::code() const noexcept
+{
+    return m_code;
+}
+
+inline bool Message::has_description() const noexcept
+{
+    return m_has_description;
+}
+
+inline std::string_view Message::name() const noexcept
+{
+    return m_name.get();
+}
+
+inline std::uint32_t Message::name_id() const noexcept
+{
+    return m_name.id();
+}
+
+inline const util::FormatArgs& Message::format_args() const noexcept
+{
+    return m_format;
+}
+
+inline Message::Severity Message::severity() const noexcept
+{
+    return m_severity;
+}
+
+inline unsigned int Message::line() const noexcept
+{
+    return m_source_location.line();
+}
+
+inline unsigned int Message::column() const noexcept
+{
+    return m_source_location.column();
+}
+
+inline std::string_view Message::file() const noexcept
+{
+    return m_source_location.file_name();
+}
+
+inline const std::source_location& Message::location() const noexcept
+{
+    return m_source_location;
+}
+
+inline std::uint64_t Message::timestamp() const noexcept
+{
+    return m_timestamp;
+}
+
+template <typename... Args>
+Message::Message(
+    const unsigned int code,
+    util::NoThrowString name,
+    const Severity severity,
+    util::FormatString<std::type_identity_t<Args>...> description,
+    Args&&... args
+)
+    : Message(code, std::move(name), util::FormatArgs(description, std::forward<Args>(args)...), severity, description.location)
+{}
+
+template <Message::Severity S>
+template <typename... Args>
+SeverityMessage<S>::SeverityMessage(
+    const unsigned int code,
+    util::NoThrowString name,
+    util::FormatString<std::type_identity_t<Args>...> description,
+    Args&&... args
+)
+    : Message(code, std::move(name), S, description, std::forward<Args>(args)...)
+{}
+
+template <Message::Severity S>
+template <typename... Args>
+SeverityMessage<S>::SeverityMessage(std::in_place_t, Args&&... args)
+    : Message(std::forward<Args>(args)...)
+{}
+
+template <typename T>
+Message& Message::add_field(const std::string_view key, const T& value) & noexcept
+{
+    m_fields.add(key, value);
+    m_what.reset();
+    return *this;
+}
+
+template <typename T>
+Message Message::add_field(const std::string_view key, const T& value) && noexcept
+{
+    m_fields.add(key, value);
+    m_what.reset();
+    return std::move(*this);
+}
 }
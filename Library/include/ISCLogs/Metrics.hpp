@@ -0,0 +1,193 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ISCLogs/Message.hpp"
+#include "ISCLogs/ThreadLocalSlots.hpp"
+
+namespace isc
+{
+/**
+ * Counts what logging itself costs: how many messages were logged or filtered out, how long the sink took, how many
+ * bytes were written, how full an AsyncLogger's queue got and how many messages it dropped.
+ * Every thread counts into a shard of its own, so counting never contends, and costs a load and a store.
+ * Snapshots add the shards up, so they may miss what is being counted while they are taken, but never lose it.
+ * Counts are filled in by MetricsLogger, and by the loggers that metrics are set on, e.g. AsyncLogger::set_metrics.
+ */
+class Metrics
+{
+public:
+    static constexpr std::size_t severity_count = 6;
+
+    /**
+     * A histogram of durations in nanoseconds, with buckets whose width grows with their value, like HdrHistogram.
+     * Every power of two is split into sub_buckets buckets, so the value a bucket reports is off by at most 1/sub_buckets.
+     */
+    class Histogram
+    {
+    public:
+        static constexpr std::size_t sub_bucket_bits = 3;
+        static constexpr std::size_t sub_buckets     = std::size_t(1) << sub_bucket_bits;
+        static constexpr std::size_t bucket_count    = (64 - sub_bucket_bits + 1) * sub_buckets;
+
+        /**
+         * Returns the bucket a value falls into.
+         * @param value The value, in nanoseconds.
+         */
+        [[nodiscard]] static constexpr std::size_t bucket_of(std::uint64_t value) noexcept;
+
+        /**
+         * Returns the highest value that falls into a bucket.
+         * @param bucket The bucket.
+         */
+        [[nodiscard]] static constexpr std::uint64_t upper_bound(std::size_t bucket) noexcept;
+
+        /**
+         * Returns the value that a fraction of the values are at or below, e.g. 0.99 for the 99th percentile.
+         * The value is the upper bound of the bucket it falls in, or 0 if the histogram is empty.
+         * @param fraction The fraction, between 0 and 1.
+         */
+        [[nodiscard]] std::uint64_t percentile(double fraction) const noexcept;
+
+        std::array<std::uint64_t, bucket_count> counts = {};
+        std::uint64_t count                            = 0;
+        // The sum of every value, in nanoseconds.
+        std::uint64_t sum                              = 0;
+        std::uint64_t max                              = 0;
+    };
+
+    /**
+     * The counts at the time of a snapshot.
+     */
+    struct Snapshot
+    {
+        // The messages that were passed on to the sink, by severity.
+        std::array<std::uint64_t, severity_count> logged   = {};
+        // The messages that the sink's threshold filtered out, by severity.
+        std::array<std::uint64_t, severity_count> filtered = {};
+        std::uint64_t bytes_written                        = 0;
+        std::uint64_t dropped                              = 0;
+        // The amount of messages in the queue when the worker last looked, and the most it has seen.
+        std::uint64_t queue_depth                          = 0;
+        std::uint64_t queue_high_water                     = 0;
+        // How long the sink took to log each message.
+        Histogram latency;
+    };
+
+    Metrics() noexcept = default;
+
+    Metrics(const Metrics&)            = delete;
+    Metrics& operator=(const Metrics&) = delete;
+
+    /**
+     * Counts a message that was passed on to the sink, and how long the sink took to log it.
+     * @param severity The severity of the message.
+     * @param nanoseconds How long the sink took.
+     */
+    void count_logged(Message::Severity severity, std::uint64_t nanoseconds) noexcept;
+
+    /**
+     * Counts a message that the sink's threshold filtered out.
+     * @param severity The severity of the message.
+     */
+    void count_filtered(Message::Severity severity) noexcept;
+
+    /**
+     * Counts bytes written by a sink.
+     * @param bytes The amount of bytes.
+     */
+    void count_bytes(std::uint64_t bytes) noexcept;
+
+    /**
+     * Counts messages dropped by a queue.
+     * @param messages The amount of messages.
+     */
+    void count_dropped(std::uint64_t messages) noexcept;
+
+    /**
+     * Sets the amount of messages in a queue, and raises the high-water mark if it is higher.
+     * Meant to be called by the one thread that drains the queue, e.g. the worker of an AsyncLogger.
+     * @param depth The amount of messages in the queue.
+     */
+    void set_queue_depth(std::uint64_t depth) noexcept;
+
+    /**
+     * Adds up the counts of every thread.
+     */
+    [[nodiscard]] Snapshot snapshot() const noexcept;
+
+    /**
+     * Appends a snapshot to a string in the Prometheus text exposition format.
+     * @param snapshot The snapshot to format.
+     * @param out The string to append to.
+     * @param prefix The prefix of the name of every metric.
+     */
+    static void format_prometheus(const Snapshot& snapshot, std::string& out, std::string_view prefix = "isclogs");
+
+    /**
+     * Writes a snapshot to a file in the Prometheus text exposition format, e.g. for node_exporter's textfile collector.
+     * The file is written next to the path and renamed over it, so readers never see it half written.
+     * @param path The path of the file.
+     * @param prefix The prefix of the name of every metric.
+     * @return Whether the file could be written.
+     */
+    bool write_prometheus(const std::string& path, std::string_view prefix = "isclogs") const noexcept;
+
+private:
+    // Every field is only ever written by the thread owning the shard, so counting needs no read-modify-write.
+    struct alignas(64) Shard
+            : util::ThreadSlot
+    {
+        std::array<std::atomic<std::uint64_t>, severity_count> logged   = {};
+        std::array<std::atomic<std::uint64_t>, severity_count> filtered = {};
+        std::atomic<std::uint64_t> bytes_written                        = 0;
+        std::atomic<std::uint64_t> dropped                              = 0;
+        std::array<std::atomic<std::uint64_t>, Histogram::bucket_count> latency = {};
+        std::atomic<std::uint64_t> latency_sum                          = 0;
+        std::atomic<std::uint64_t> latency_max                          = 0;
+    };
+
+    [[nodiscard]] Shard* local_shard() noexcept;
+    static void add(std::atomic<std::uint64_t>& counter, std::uint64_t amount) noexcept;
+
+    std::atomic<std::uint64_t> m_queue_depth      = 0;
+    std::atomic<std::uint64_t> m_queue_high_water = 0;
+
+    util::ThreadLocalSlots<Shard> m_shards;
+};
+
+constexpr std::size_t Metrics::Histogram::bucket_of(const std::uint64_t value) noexcept
+{
+    if (value < sub_buckets)
+        return static_cast<std::size_t>(value);
+
+    // The top sub_bucket_bits + 1 bits of the value pick the bucket, the leading one giving the power of two.
+    const std::size_t exponent = static_cast<std::size_t>(std::bit_width(value)) - 1;
+    const std::size_t sub      = static_cast<std::size_t>(value >> (exponent - sub_bucket_bits)) & (sub_buckets - 1);
+    return (exponent - sub_bucket_bits + 1) * sub_buckets + sub;
+}
+
+constexpr std::uint64_t Metrics::Histogram::upper_bound(const std::size_t bucket) noexcept
+{
+    if (bucket < sub_buckets)
+        return bucket;
+
+    const std::size_t exponent = bucket / sub_buckets + sub_bucket_bits - 1;
+    const std::size_t shift    = exponent - sub_bucket_bits;
+    const std::uint64_t lower  = (std::uint64_t(sub_buckets) + bucket % sub_buckets) << shift;
+    return lower + ((std::uint64_t(1) << shift) - 1);
+}
+} // isc
@@ -0,0 +1,50 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include "ISCLogs/Logger.hpp"
+#include "ISCLogs/Metrics.hpp"
+
+namespace isc
+{
+/**
+ * A logger that counts the messages it passes on to another logger, along with how long that logger took to log each.
+ * Messages the sink's threshold filters out are counted as filtered instead of being passed on.
+ * In front of an AsyncLogger it measures what logging costs the calling thread, behind it what the sink costs the worker.
+ */
+class MetricsLogger
+        : public Logger
+{
+public:
+    /**
+     * Constructs the logger.
+     * The logger accepts every severity by default, so that it sees what the sink filters out, use set_severity to not
+     * count the lowest severities at all.
+     * @param sink The logger that messages are logged through, it must outlive this logger.
+     * @param metrics The metrics to count into, they must outlive this logger.
+     */
+    MetricsLogger(Logger& sink, Metrics& metrics) noexcept;
+
+    MetricsLogger(const MetricsLogger&)            = delete;
+    MetricsLogger& operator=(const MetricsLogger&) = delete;
+
+protected:
+    /**
+     * Logs a message through the sink and counts it, or counts it as filtered if the sink's threshold filters it out.
+     * @param message The message to log.
+     */
+    void log_message_internal(const Message& message) const noexcept override;
+
+    /**
+     * Logs a record through the sink and counts it, or counts it as filtered if the sink's threshold filters it out.
+     * @param record The record to log.
+     */
+    void log_record_internal(const Record& record) const noexcept override;
+
+private:
+    Logger& m_sink;
+    Metrics& m_metrics;
+};
+} // isc
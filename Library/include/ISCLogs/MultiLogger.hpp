@@ -0,0 +1,93 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+#include "ISCLogs/Logger.hpp"
+#include "ISCLogs/RenderCache.hpp"
+
+namespace isc
+{
+/**
+ * A logger that passes every message on to several other loggers, each with a threshold of its own.
+ * The logger's own threshold is kept at the lowest of its sinks' thresholds, so messages no sink wants are rejected
+ * before being built, and the text of a message is formatted at most once no matter how many sinks log it.
+ * A threshold set with set_severity, e.g. by a LoggerRegistry, overrides the sinks' one and is kept when sinks are added,
+ * until it is set back to the sinks' threshold. Either way, the sinks' thresholds still apply to each of them.
+ * MultiLoggers can be added to each other to build a tree, and the text is still only formatted once.
+ */
+class MultiLogger
+        : public Logger
+{
+public:
+    static constexpr std::size_t max_sinks = 16;
+
+    /**
+     * Constructs the logger without any sinks, so it rejects everything until one is added.
+     */
+    MultiLogger() noexcept;
+
+    MultiLogger(const MultiLogger&)            = delete;
+    MultiLogger& operator=(const MultiLogger&) = delete;
+
+    /**
+     * Adds a sink that messages of at least the given severity are passed on to.
+     * The sink's own threshold still applies, and sinks can be added while other threads are logging.
+     * @param sink The logger to pass messages on to, it must outlive this logger.
+     * @param threshold The threshold above which messages are passed on to the sink.
+     * @return Whether the sink was added, false if there already are max_sinks sinks.
+     */
+    bool add_sink(const Logger& sink, Message::Severity threshold = Message::Severity::Debug) noexcept;
+
+    /**
+     * Returns the amount of sinks that have been added.
+     */
+    [[nodiscard]] std::size_t sink_count() const noexcept;
+
+protected:
+    /**
+     * Passes a message on to every sink whose threshold it is above.
+     * @param message The message to log.
+     */
+    void log_message_internal(const Message& message) const noexcept override;
+
+    /**
+     * Passes a record on to every sink whose threshold it is above.
+     * @param record The record to log.
+     */
+    void log_record_internal(const Record& record) const noexcept override;
+
+    /**
+     * Passes a message on to every sink whose threshold it is above, sharing the text of the parent's dispatch.
+     * @param message The message to log.
+     * @param cache The text of the message, formatted on first use.
+     */
+    void log_shared_message_internal(const Message& message, const RenderCache& cache) const noexcept override;
+
+    /**
+     * Passes a record on to every sink whose threshold it is above, sharing the text of the parent's dispatch.
+     * @param record The record to log.
+     * @param cache The text of the record, formatted on first use.
+     */
+    void log_shared_record_internal(const Record& record, const RenderCache& cache) const noexcept override;
+
+private:
+    struct Sink
+    {
+        const Logger* logger        = nullptr;
+        Message::Severity threshold = Message::Severity::Debug;
+    };
+
+    // Sinks are only ever appended, and published by bumping the count, so dispatching never locks.
+    Sink m_sinks[max_sinks];
+    std::atomic<std::size_t> m_sink_count = 0;
+    std::mutex m_mutex;
+    // The lowest of the sinks' thresholds, which is the logger's own unless set_severity overrode it.
+    Message::Severity m_sinks_threshold = Message::Severity::Fatal;
+};
+} // isc
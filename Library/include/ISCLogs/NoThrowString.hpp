@@ -4,17 +4,38 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <string_view>
 
 namespace isc::util
 {
+class MemoryPool;
+
+/**
+ * An immutable string that never throws, and avoids allocating whenever it can.
+ * Short strings are stored inline, strings with static lifetime can be referenced without copying them,
+ * and long strings are stored once on the heap and shared between copies through a reference count.
+ */
 class NoThrowString
 {
 public:
+    static constexpr std::size_t inline_capacity = 40;
+
     NoThrowString() noexcept;
     NoThrowString(const std::string& string) noexcept;
+    NoThrowString(std::string_view string) noexcept;
     NoThrowString(const char* string) noexcept;
+
+    /**
+     * Constructs a copy of the given characters, taking the heap storage of long strings from a pool instead of the global heap.
+     * Copies share the pooled storage, and it is returned to the pool by whichever copy is destroyed last, on any thread.
+     * @param string The characters to copy.
+     * @param pool The pool to allocate from, it must outlive every copy of the string.
+     */
+    NoThrowString(std::string_view string, MemoryPool& pool) noexcept;
     ~NoThrowString() noexcept;
 
     NoThrowString(const NoThrowString& string) noexcept;
@@ -23,11 +44,73 @@ public:
     NoThrowString(NoThrowString&& string) noexcept;
     NoThrowString& operator=(NoThrowString&& string) noexcept;
 
+    /**
+     * Constructs a string that references the given characters instead of copying them.
+     * @param string The characters to reference, they must outlive every copy of the string, e.g. a string literal.
+     */
+    [[nodiscard]] static NoThrowString from_static(std::string_view string) noexcept;
+
+    /**
+     * Constructs a string that references a copy of the given characters in the global InternTable, and carries their id.
+     * Falls back to a regular copy if the table is full.
+     * @param string The characters to intern.
+     */
+    [[nodiscard]] static NoThrowString interned(std::string_view string) noexcept;
+
     [[nodiscard]] std::string_view get() const noexcept;
 
+    /**
+     * Returns the string's id in the global InternTable, or 0 if the string was not constructed through interned().
+     */
+    [[nodiscard]] std::uint32_t id() const noexcept;
+
 private:
-    static constexpr const char* s_default_string = "Default String";
+    enum class Storage : std::uint8_t
+    {
+        Static, // m_static references characters owned by someone else.
+        Inline, // m_inline holds the characters.
+        Shared,  // m_shared holds the characters on the heap, along with a reference count.
+        Interned // m_interned references characters owned by the global InternTable, along with their id.
+    };
+
+    struct InternedString
+    {
+        const char* data;
+        std::uint32_t id;
+    };
 
-    std::string* m_str = nullptr;
+    struct SharedBlock
+    {
+        std::atomic<std::size_t> references;
+        // Whether the block came from a MemoryPool rather than the global heap.
+        bool pooled;
+        char data[1];
+    };
+
+    void assign(std::string_view string, MemoryPool* pool = nullptr) noexcept;
+    void copy_from(const NoThrowString& string) noexcept;
+    void steal_from(NoThrowString& string) noexcept;
+    void reset() noexcept;
+
+    static constexpr std::string_view s_default_string = "Default String";
+
+    union
+    {
+        char m_inline[inline_capacity];
+        const char* m_static;
+        SharedBlock* m_shared;
+        InternedString m_interned;
+    };
+
+    std::uint32_t m_size = 0;
+    Storage m_storage    = Storage::Static;
 };
+
+namespace literals
+{
+/**
+ * Constructs a NoThrowString that references a string literal without copying it.
+ */
+[[nodiscard]] NoThrowString operator""_nts(const char* string, std::size_t size) noexcept;
+}
 } // vulren
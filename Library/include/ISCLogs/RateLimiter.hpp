@@ -0,0 +1,162 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <source_location>
+
+#include "ISCLogs/Logger.hpp"
+#include "ISCLogs/Macros.hpp"
+
+namespace isc
+{
+/**
+ * A logger that limits how often each call site can log through another logger, and periodically reports how many
+ * messages it suppressed. Call sites are told apart by their code, file and line, and their state is kept in a fixed
+ * size lock-free hash table, so the check never locks and costs a fraction of building the message.
+ */
+class RateLimiter
+        : public Logger
+{
+public:
+    /**
+     * How messages from a call site are limited.
+     */
+    enum class Mode
+    {
+        TokenBucket, // Let through a burst of messages, then at most a fixed rate.
+        Sample       // Let through one message in every N.
+    };
+
+    struct Options
+    {
+        Mode mode = Mode::TokenBucket;
+        // The amount of messages per second each call site may log once its burst is spent, for TokenBucket.
+        double rate = 10.0;
+        // The amount of messages each call site may log at once, for TokenBucket.
+        std::uint32_t burst = 100;
+        // Let through the first of every sample_every messages, for Sample.
+        std::uint32_t sample_every = 100;
+        // How often suppressed messages are reported, 0 to only report them through report_suppressed.
+        std::chrono::milliseconds summary_interval = std::chrono::milliseconds(1000);
+        // The amount of call sites that are tracked, rounded up to a power of two. Call sites past it are not limited.
+        std::size_t capacity = 4096;
+    };
+
+    /**
+     * Constructs the limiter with the default options.
+     * The limiter accepts every severity by default and leaves the filtering to the sink, use set_severity to filter earlier.
+     * @param sink The logger that messages which are let through are logged through, it must outlive this limiter.
+     */
+    explicit RateLimiter(Logger& sink) noexcept;
+
+    /**
+     * Constructs the limiter.
+     * @param sink The logger that messages which are let through are logged through, it must outlive this limiter.
+     * @param options How messages are limited, and how often suppressed messages are reported.
+     */
+    RateLimiter(Logger& sink, const Options& options) noexcept;
+
+    /**
+     * Reports the messages suppressed since the last report.
+     */
+    ~RateLimiter() noexcept override;
+
+    RateLimiter(const RateLimiter&)            = delete;
+    RateLimiter& operator=(const RateLimiter&) = delete;
+
+    /**
+     * Returns whether a message from a call site may be logged now, and counts it as suppressed otherwise.
+     * This is what ISC_LOG_LIMITED checks before building the message.
+     * @param code The code of the message.
+     * @param location The location the message is logged from.
+     */
+    [[nodiscard]] bool admit(unsigned int code, const std::source_location& location) const noexcept;
+
+    /**
+     * Logs a message that admit already let through, without checking it again.
+     * @param message The message to log.
+     */
+    void log_admitted(const Message& message) const noexcept;
+
+    /**
+     * Logs a warning through the sink for every call site that had messages suppressed since the last report.
+     */
+    void report_suppressed() const noexcept;
+
+    /**
+     * Returns the total amount of messages suppressed so far, summed over every call site.
+     */
+    [[nodiscard]] std::uint64_t suppressed() const noexcept;
+
+protected:
+    /**
+     * Logs a message through the sink if its call site is within its limit.
+     * @param message The message to log.
+     */
+    void log_message_internal(const Message& message) const noexcept override;
+
+    /**
+     * Logs a record through the sink if its call site is within its limit.
+     * @param record The record to log.
+     */
+    void log_record_internal(const Record& record) const noexcept override;
+
+private:
+    struct alignas(64) Site
+    {
+        // 0 while the slot is free, claimed with a compare exchange.
+        std::atomic<std::uint64_t> key = 0;
+        // Set once code, file and line have been written, so the reporter can read them.
+        std::atomic<bool> ready = false;
+        unsigned int code       = 0;
+        std::uint32_t line      = 0;
+        const char* file        = nullptr;
+
+        // The theoretical arrival time of the next message for TokenBucket, or the amount of messages seen for Sample.
+        std::atomic<std::uint64_t> state      = 0;
+        std::atomic<std::uint64_t> suppressed = 0;
+        std::atomic<std::uint64_t> reported   = 0;
+    };
+
+    [[nodiscard]] Site* find_site(unsigned int code, const std::source_location& location) const noexcept;
+    [[nodiscard]] static std::uint64_t now() noexcept;
+    void maybe_report() const noexcept;
+
+    Logger& m_sink;
+    Options m_options;
+    std::uint64_t m_interval;
+    std::uint64_t m_tolerance;
+
+    Site* m_sites      = nullptr;
+    std::size_t m_mask = 0;
+    mutable std::atomic<std::uint64_t> m_next_report = 0;
+};
+} // isc
+
+/**
+ * Logs a message through a rate limiter, without building the message unless both the limiter's threshold
+ * and the limit of the call site let it through.
+ * @param limiter The RateLimiter to log the message through.
+ * @param severity The name of the severity of the message, e.g. Warning.
+ * @param code The code of the message, which is part of what identifies the call site.
+ * @param ... The name and optionally the description of the message.
+ */
+#define ISC_LOG_LIMITED(limiter, severity, code, ...)                                                                  \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if constexpr (::isc::Message::Severity::severity >= ::isc::compiled_min_severity)                              \
+        {                                                                                                              \
+            const ::isc::RateLimiter& isc_log_limiter_ = (limiter);                                                    \
+            const unsigned int isc_log_code_           = (code);                                                       \
+            if (isc_log_limiter_.should_log(::isc::Message::Severity::severity)                                        \
+                && isc_log_limiter_.admit(isc_log_code_, ::std::source_location::current()))                           \
+                isc_log_limiter_.log_admitted(                                                                         \
+                    ::isc::Message(isc_log_code_, __VA_ARGS__, ::isc::Message::Severity::severity));                   \
+        }                                                                                                              \
+    } while (false)
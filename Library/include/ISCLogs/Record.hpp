@@ -0,0 +1,264 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "ISCLogs/Message.hpp"
+
+namespace isc
+{
+/**
+ * A flat, trivially copyable snapshot of a message that can be queued or buffered without allocating.
+ * The name, description and trace are stored back to back in an inline buffer, and only spill to the heap
+ * when they do not fit in it. A description that has not been formatted yet is stored as its encoded arguments,
+ * so that it is only formatted by whoever ends up writing the record. A record that spilled owns its heap storage through a plain pointer, so whoever
+ * consumes the record last has to call release().
+ */
+class Record
+{
+public:
+    static constexpr std::size_t inline_capacity = 192;
+
+    /**
+     * Constructs an empty record.
+     */
+    Record() noexcept = default;
+
+    /**
+     * Captures a message, along with the current time and thread.
+     * If the text of the message does not fit in the inline buffer and the spill allocation fails, the text is truncated.
+     * @param message The message to capture.
+     */
+    explicit Record(const Message& message) noexcept;
+
+    /**
+     * Captures a message, along with the current time and thread.
+     * @param message The message to capture.
+     * @param spill Whether text that does not fit in the inline buffer spills to the heap, or is truncated instead.
+     */
+    Record(const Message& message, bool spill) noexcept;
+
+    /**
+     * Returns a copy of the record that owns its own heap storage, if the record spilled.
+     * If the allocation fails, the copy's text is truncated to the inline buffer.
+     */
+    [[nodiscard]] Record clone() const noexcept;
+
+    /**
+     * Returns a copy of the record whose text is kept in the inline buffer, so that it never has to be released.
+     * Text that does not fit is truncated, trace frames and fields first.
+     */
+    [[nodiscard]] Record inline_copy() const noexcept;
+
+    /**
+     * Frees the heap storage of a record whose text did not fit inline. Every copy of the record is invalidated.
+     */
+    void release() noexcept;
+
+    /**
+     * Rebuilds a message from the record, this allocates like any other message construction.
+     */
+    [[nodiscard]] Message to_message() const;
+
+    /**
+     * Returns a string containing the information contained in the record, formatted like Message::message().
+     */
+    [[nodiscard]] std::string message() const;
+
+    /**
+     * Appends the information contained in the record to a string, formatted like Message::message().
+     * @param out The string to append to.
+     */
+    void format_to(std::string& out) const;
+
+    /**
+     * Appends the description to a string, formatting it first if it is deferred.
+     * @param out The string to append to.
+     */
+    void format_description_to(std::string& out) const;
+
+    /**
+     * Returns whether the record is considered a failure, e.g. its severity is Error or higher.
+     */
+    [[nodiscard]] bool is_failure() const noexcept;
+
+    /**
+     * Returns the numerical code of the record.
+     */
+    [[nodiscard]] unsigned int code() const noexcept;
+
+    /**
+     * Returns the severity of the record.
+     */
+    [[nodiscard]] Message::Severity severity() const noexcept;
+
+    /**
+     * Returns whether the record has a description.
+     */
+    [[nodiscard]] bool has_description() const noexcept;
+
+    /**
+     * Returns the name of the record.
+     */
+    [[nodiscard]] std::string_view name() const noexcept;
+
+    /**
+     * Returns the id of the record's name in the global util::InternTable, or 0 if the name is not interned.
+     * Interned names are not copied into the record's text.
+     */
+    [[nodiscard]] std::uint32_t name_id() const noexcept;
+
+    /**
+     * Returns the description of the record, or its format string if formatting the description was deferred.
+     */
+    [[nodiscard]] std::string_view description() const noexcept;
+
+    /**
+     * Returns whether formatting the description was deferred, in which case format_to formats it.
+     */
+    [[nodiscard]] bool deferred() const noexcept;
+
+    /**
+     * Returns the encoded arguments of a deferred description, see util::FormatArgs.
+     */
+    [[nodiscard]] std::span<const std::byte> arguments() const noexcept;
+
+    /**
+     * Returns the fields of the message, which are dropped as a whole if they do not fit.
+     */
+    [[nodiscard]] util::Fields::View fields() const noexcept;
+
+    /**
+     * Returns the amount of trace frames held by the record.
+     */
+    [[nodiscard]] std::size_t trace_size() const noexcept;
+
+    /**
+     * Returns a trace frame, in the order they were added to the message.
+     * @param index The index of the frame, must be less than trace_size().
+     */
+    [[nodiscard]] std::string_view trace(std::size_t index) const noexcept;
+
+    /**
+     * Returns the location in the code that the message was generated from.
+     */
+    [[nodiscard]] const std::source_location& location() const noexcept;
+
+    /**
+     * Returns the time the message was constructed at, in nanoseconds since the unix epoch.
+     */
+    [[nodiscard]] std::uint64_t timestamp() const noexcept;
+
+    /**
+     * Returns the id of the thread that captured the record.
+     */
+    [[nodiscard]] std::uint64_t thread_id() const noexcept;
+
+    /**
+     * Returns whether the text of the record was cut short to fit in the inline buffer.
+     */
+    [[nodiscard]] bool truncated() const noexcept;
+
+    /**
+     * Returns whether the text of the record lives on the heap and must be released.
+     */
+    [[nodiscard]] bool spilled() const noexcept;
+
+    /**
+     * Returns a small process-unique id for the calling thread, starting at 1.
+     */
+    [[nodiscard]] static std::uint64_t current_thread_id() noexcept;
+
+private:
+    [[nodiscard]] const char* text() const noexcept;
+
+    std::uint32_t m_code             = 0;
+    Message::Severity m_severity     = Message::Severity::Nominal;
+    bool m_has_description           = false;
+    bool m_truncated                 = false;
+    std::uint16_t m_trace_size       = 0;
+    std::uint32_t m_name_id          = 0;
+    std::uint32_t m_name_size        = 0;
+    std::uint32_t m_description_size = 0;
+    std::uint32_t m_fields_size      = 0;
+    std::uint32_t m_text_size        = 0;
+    std::uint32_t m_format_size      = 0;
+    const char* m_format             = nullptr;
+    std::source_location m_source_location;
+    std::uint64_t m_timestamp        = 0;
+    std::uint64_t m_thread_id        = 0;
+    char* m_spill                    = nullptr;
+    char m_inline[inline_capacity];
+};
+
+static_assert(std::is_trivially_copyable_v<Record>, "Records are copied into queues and buffers with memcpy");
+
+inline bool Record::is_failure() const noexcept
+{
+    return m_severity >= Message::Severity::Error;
+}
+
+inline unsigned int Record::code() const noexcept
+{
+    return m_code;
+}
+
+inline Message::Severity Record::severity() const noexcept
+{
+    return m_severity;
+}
+
+inline bool Record::has_description() const noexcept
+{
+    return m_has_description;
+}
+
+inline std::uint32_t Record::name_id() const noexcept
+{
+    return m_name_id;
+}
+
+inline bool Record::deferred() const noexcept
+{
+    return m_format != nullptr;
+}
+
+inline std::size_t Record::trace_size() const noexcept
+{
+    return m_trace_size;
+}
+
+inline const std::source_location& Record::location() const noexcept
+{
+    return m_source_location;
+}
+
+inline std::uint64_t Record::timestamp() const noexcept
+{
+    return m_timestamp;
+}
+
+inline std::uint64_t Record::thread_id() const noexcept
+{
+    return m_thread_id;
+}
+
+inline bool Record::truncated() const noexcept
+{
+    return m_truncated;
+}
+
+inline bool Record::spilled() const noexcept
+{
+    return m_spill != nullptr;
+}
+} // isc
@@ -0,0 +1,52 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "ISCLogs/Message.hpp"
+#include "ISCLogs/Record.hpp"
+
+namespace isc
+{
+/**
+ * Holds the text of a message or record while it is being passed to several loggers, so that it is formatted at most once.
+ * A cache only lives for a single dispatch on a single thread, and must not outlive the message or record it was made for.
+ */
+class RenderCache
+{
+public:
+    /**
+     * @param message The message being dispatched.
+     */
+    explicit RenderCache(const Message& message) noexcept;
+
+    /**
+     * @param record The record being dispatched.
+     */
+    explicit RenderCache(const Record& record) noexcept;
+
+    RenderCache(const RenderCache&)            = delete;
+    RenderCache& operator=(const RenderCache&) = delete;
+
+    /**
+     * Returns the message or record formatted like Message::message(), formatting it on the first call.
+     * If formatting fails, the text is empty.
+     */
+    [[nodiscard]] std::string_view text() const noexcept;
+
+    /**
+     * Returns whether the text has been formatted already.
+     */
+    [[nodiscard]] bool rendered() const noexcept;
+
+private:
+    const Message* m_message = nullptr;
+    const Record* m_record   = nullptr;
+    mutable std::string m_text;
+    mutable bool m_rendered  = false;
+};
+} // isc
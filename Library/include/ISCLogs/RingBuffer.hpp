@@ -0,0 +1,213 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace isc::util
+{
+/**
+ * A bounded, lock-free ring buffer that supports many producers and many consumers.
+ * Each slot carries a sequence number that tells producers and consumers whose turn it is to use it,
+ * so the only shared writes on the fast path are the two position counters.
+ * @tparam T The type of element held by the buffer.
+ */
+template <typename T>
+class RingBuffer
+{
+public:
+    /**
+     * Constructs a ring buffer able to hold at least the given amount of elements.
+     * @param capacity The requested capacity, rounded up to the next power of two.
+     */
+    explicit RingBuffer(std::size_t capacity) noexcept;
+    ~RingBuffer() noexcept;
+
+    RingBuffer(const RingBuffer&)            = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    /**
+     * Attempts to push an element into the buffer.
+     * @param args The arguments used to construct the element in place.
+     * @return Whether the element was pushed, false if the buffer was full.
+     */
+    template <typename... Args>
+    bool try_push(Args&&... args) noexcept;
+
+    /**
+     * Attempts to pop the oldest element from the buffer.
+     * @param out The object the popped element will be moved into.
+     * @return Whether an element was popped, false if the buffer was empty.
+     */
+    bool try_pop(T& out) noexcept;
+
+    /**
+     * Returns whether the oldest slot of the buffer is currently empty.
+     * The result may be outdated by the time it is used if other threads are pushing or popping.
+     */
+    [[nodiscard]] bool empty() const noexcept;
+
+    /**
+     * Returns the amount of pushes that have been claimed since the buffer was created.
+     */
+    [[nodiscard]] std::size_t push_count() const noexcept;
+
+    /**
+     * Returns the amount of elements the buffer can hold.
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept;
+
+    /**
+     * Returns whether the buffer could allocate its storage.
+     */
+    [[nodiscard]] bool valid() const noexcept;
+
+private:
+    struct Slot
+    {
+        std::atomic<std::size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    static std::size_t round_capacity(std::size_t capacity) noexcept;
+
+    // Kept on separate cache lines so producers and the consumer do not fight over the same line.
+    static constexpr std::size_t s_cache_line = 64;
+
+    std::size_t m_mask  = 0;
+    Slot* m_slots       = nullptr;
+    alignas(s_cache_line) std::atomic<std::size_t> m_enqueue_position = 0;
+    alignas(s_cache_line) std::atomic<std::size_t> m_dequeue_position = 0;
+};
+
+template <typename T>
+RingBuffer<T>::RingBuffer(const std::size_t capacity) noexcept
+{
+    const std::size_t size = round_capacity(capacity);
+    m_slots                = new(std::nothrow) Slot[size];
+    if (m_slots == nullptr)
+        return;
+
+    m_mask = size - 1;
+    for (std::size_t i = 0; i < size; ++i)
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+template <typename T>
+RingBuffer<T>::~RingBuffer() noexcept
+{
+    if (m_slots == nullptr)
+        return;
+
+    T discarded;
+    while (try_pop(discarded))
+    {}
+
+    delete[] m_slots;
+}
+
+template <typename T>
+template <typename... Args>
+bool RingBuffer<T>::try_push(Args&&... args) noexcept
+{
+    if (m_slots == nullptr)
+        return false;
+
+    std::size_t position = m_enqueue_position.load(std::memory_order_relaxed);
+    while (true)
+    {
+        Slot& slot                 = m_slots[position & m_mask];
+        const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        const auto difference      = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+        if (difference == 0)
+        {
+            if (m_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                ::new(static_cast<void*>(slot.storage)) T(std::forward<Args>(args)...);
+                slot.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (difference < 0)
+            return false;
+        else
+            position = m_enqueue_position.load(std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+bool RingBuffer<T>::try_pop(T& out) noexcept
+{
+    if (m_slots == nullptr)
+        return false;
+
+    std::size_t position = m_dequeue_position.load(std::memory_order_relaxed);
+    while (true)
+    {
+        Slot& slot                 = m_slots[position & m_mask];
+        const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        const auto difference      = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+
+        if (difference == 0)
+        {
+            if (m_dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                T* element = std::launder(reinterpret_cast<T*>(slot.storage));
+                out        = std::move(*element);
+                element->~T();
+                slot.sequence.store(position + m_mask + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (difference < 0)
+            return false;
+        else
+            position = m_dequeue_position.load(std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+bool RingBuffer<T>::empty() const noexcept
+{
+    if (m_slots == nullptr)
+        return true;
+
+    const std::size_t position = m_dequeue_position.load(std::memory_order_relaxed);
+    return m_slots[position & m_mask].sequence.load(std::memory_order_acquire) != position + 1;
+}
+
+template <typename T>
+std::size_t RingBuffer<T>::push_count() const noexcept
+{
+    return m_enqueue_position.load(std::memory_order_acquire);
+}
+
+template <typename T>
+std::size_t RingBuffer<T>::capacity() const noexcept
+{
+    return m_slots == nullptr ? 0 : m_mask + 1;
+}
+
+template <typename T>
+bool RingBuffer<T>::valid() const noexcept
+{
+    return m_slots != nullptr;
+}
+
+template <typename T>
+std::size_t RingBuffer<T>::round_capacity(const std::size_t capacity) noexcept
+{
+    std::size_t size = 2;
+    while (size < capacity)
+        size <<= 1;
+
+    return size;
+}
+} // isc::util
@@ -0,0 +1,104 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace isc
+{
+class Record;
+}
+
+namespace isc::util
+{
+/**
+ * Formats text into a caller provided buffer and writes it to a file descriptor with write(2).
+ * It never allocates, locks or touches thread local storage, so it is safe to use from a signal handler.
+ * When the buffer fills up it is written out, and whatever cannot be written is dropped.
+ */
+class SignalWriter
+{
+public:
+    /**
+     * @param fd The file descriptor to write to.
+     * @param buffer The buffer that text is formatted into, it must outlive the writer.
+     */
+    SignalWriter(int fd, std::span<char> buffer) noexcept;
+    ~SignalWriter() noexcept;
+
+    SignalWriter(const SignalWriter&)            = delete;
+    SignalWriter& operator=(const SignalWriter&) = delete;
+
+    /**
+     * Appends a string.
+     * @param string The string to append.
+     */
+    void write(std::string_view string) noexcept;
+
+    /**
+     * Appends a single character.
+     * @param character The character to append.
+     */
+    void write(char character) noexcept;
+
+    /**
+     * Appends an unsigned number in decimal.
+     * @param number The number to append.
+     */
+    void write_unsigned(std::uint64_t number) noexcept;
+
+    /**
+     * Appends a signed number in decimal.
+     * @param number The number to append.
+     */
+    void write_signed(std::int64_t number) noexcept;
+
+    /**
+     * Appends a number in hexadecimal, prefixed with 0x.
+     * @param number The number to append.
+     */
+    void write_hex(std::uint64_t number) noexcept;
+
+    /**
+     * Appends a floating point number with six decimals, or in scientific notation if it is very large or very small.
+     * @param number The number to append.
+     */
+    void write_double(double number) noexcept;
+
+    /**
+     * Appends a record as a line formatted like Message::message(), prefixed with its timestamp and thread.
+     * Deferred descriptions are written as their format string, formatting them would allocate.
+     * @param record The record to append.
+     */
+    void write_record(const Record& record) noexcept;
+
+    /**
+     * Writes everything appended so far to the file descriptor.
+     */
+    void flush() noexcept;
+
+    /**
+     * Returns the file descriptor that the writer writes to.
+     */
+    [[nodiscard]] int fd() const noexcept;
+
+    /**
+     * Writes a whole block of memory to a file descriptor, retrying short and interrupted writes.
+     * @param fd The file descriptor to write to.
+     * @param data The memory to write.
+     * @param size The amount of bytes to write.
+     * @return Whether everything was written.
+     */
+    static bool write_all(int fd, const void* data, std::size_t size) noexcept;
+
+private:
+    int m_fd;
+    std::span<char> m_buffer;
+    std::size_t m_size = 0;
+};
+} // isc::util
@@ -0,0 +1,132 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "ISCLogs/Logger.hpp"
+#include "ISCLogs/RingBuffer.hpp"
+#include "ISCLogs/ThreadLocalSlots.hpp"
+
+namespace isc
+{
+/**
+ * A logger that stages messages in a buffer owned by the logging thread, and has a flusher thread merge the buffers
+ * into another logger in batches, ordered by the time the messages were captured.
+ * Logging threads never share a lock or a buffer with each other, and the sink is only ever called from the flusher,
+ * so it needs no locking of its own.
+ */
+class StagingLogger
+        : public Logger
+{
+public:
+    struct Options
+    {
+        // The amount of records each thread can stage, rounded up to a power of two.
+        std::size_t buffer_capacity = 1024;
+        // The longest a record stays staged before the flusher picks it up.
+        std::chrono::milliseconds flush_interval = std::chrono::milliseconds(50);
+        // Messages of this severity or higher wake the flusher immediately, and fatal messages wait for it.
+        Message::Severity flush_severity = Message::Severity::Error;
+    };
+
+    /**
+     * Constructs the logger with the default options and starts its flusher thread.
+     * The logger accepts every severity by default and leaves the filtering to the sink, use set_severity to filter earlier.
+     * @param sink The logger that the flusher logs messages through, it must outlive this logger.
+     */
+    explicit StagingLogger(Logger& sink) noexcept;
+
+    /**
+     * Constructs the logger and starts its flusher thread.
+     * @param sink The logger that the flusher logs messages through, it must outlive this logger.
+     * @param options The size of each thread's buffer, and when the buffers are flushed.
+     */
+    StagingLogger(Logger& sink, const Options& options) noexcept;
+    ~StagingLogger() noexcept override;
+
+    StagingLogger(const StagingLogger&)            = delete;
+    StagingLogger& operator=(const StagingLogger&) = delete;
+
+    /**
+     * Blocks until every message staged before the call, by any thread, has been logged by the sink.
+     */
+    void flush() noexcept;
+
+    /**
+     * Logs every staged message and stops the flusher thread.
+     * Messages logged after shutting down are passed straight to the sink on the calling thread.
+     */
+    void shutdown() noexcept;
+
+protected:
+    /**
+     * Stages a message in the calling thread's buffer.
+     * @param message The message to log.
+     */
+    void log_message_internal(const Message& message) const noexcept override;
+
+    /**
+     * Stages a copy of a record in the calling thread's buffer.
+     * @param record The record to log.
+     */
+    void log_record_internal(const Record& record) const noexcept override;
+
+    /**
+     * Writes every staged record that the flusher has not picked up yet, called by CrashHandler.
+     * Records are written buffer by buffer, rather than merged by timestamp.
+     * @param writer The writer to write the records to.
+     */
+    void dump_pending_internal(util::SignalWriter& writer) const noexcept override;
+
+private:
+    struct ThreadBuffer
+            : util::ThreadSlot
+    {
+        explicit ThreadBuffer(std::size_t capacity) noexcept;
+
+        util::RingBuffer<Record> records;
+        // Only touched by the owning thread, counts the records staged since it last woke the flusher.
+        std::size_t staged_since_wake = 0;
+    };
+
+    [[nodiscard]] ThreadBuffer* local_buffer() const noexcept;
+    void wait_for_flush() const noexcept;
+    void stage(Record record) const noexcept;
+    void request_flush() const noexcept;
+    void run() noexcept;
+    void flush_buffers() noexcept;
+
+    Logger& m_sink;
+    Options m_options;
+    // Only contended when a thread logs to the sink directly, without a buffer of its own or once the flusher has stopped.
+    mutable std::mutex m_sink_mutex;
+    util::ThreadLocalSlots<ThreadBuffer> m_buffers;
+    std::vector<ThreadBuffer*> m_snapshot;
+    std::vector<Record> m_batch;
+    std::vector<std::pair<std::uint64_t, std::uint32_t>> m_order;
+
+    mutable std::mutex m_mutex;
+    mutable std::condition_variable m_wake;
+    mutable bool m_flush_requested = false;
+    bool m_stopping                = false;
+    std::atomic<bool> m_stopped    = false;
+
+    // Flushes are numbered, so flush() can wait for a pass that started after it was called.
+    mutable std::atomic<std::uint64_t> m_requested = 0;
+    mutable std::atomic<std::uint64_t> m_served    = 0;
+    mutable std::atomic<std::uint64_t> m_passes    = 0;
+    std::thread m_flusher;
+};
+} // isc
@@ -0,0 +1,247 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace isc::util
+{
+/**
+ * The base of the objects kept by ThreadLocalSlots, which records the thread that owns one.
+ */
+class ThreadSlot
+{
+public:
+    /**
+     * Returns whether the calling thread owns the slot.
+     */
+    [[nodiscard]] bool owned() const noexcept;
+
+    /**
+     * Returns whether the thread that owned the slot has exited, and no other thread has taken the slot over yet.
+     */
+    [[nodiscard]] bool abandoned() const noexcept;
+
+private:
+    template <typename T>
+    friend class ThreadLocalSlots;
+
+    // Its address tells threads apart, and it stays unique for as long as the thread is alive.
+    [[nodiscard]] static const void* this_thread() noexcept;
+
+    // nullptr once the owning thread has exited, until another thread takes the slot over.
+    std::atomic<const void*> m_owner = nullptr;
+};
+
+/**
+ * One object per thread for each instance of an owner, e.g. the counters of a Metrics object, that the owner can reach
+ * every one of. Each thread keeps its own list of the slots it uses, found without locking, and the owner keeps the
+ * slots of every thread. Both hold on to a slot, so either the thread or the owner can go away first.
+ * Once a thread has exited, its slots are taken over by the next thread to use the same owner, so memory stays bounded
+ * by the amount of threads alive at once. While a thread is exiting and after its slots have been let go of, it gets none.
+ * @tparam T The type of the slots, which derives from ThreadSlot.
+ */
+template <typename T>
+class ThreadLocalSlots
+{
+public:
+    ThreadLocalSlots() noexcept;
+
+    ThreadLocalSlots(const ThreadLocalSlots&)            = delete;
+    ThreadLocalSlots& operator=(const ThreadLocalSlots&) = delete;
+
+    /**
+     * Returns the calling thread's slot. On the thread's first call, it takes over the slot of a thread that has exited
+     * if there is one, or makes a new one otherwise.
+     * @param create Returns a std::shared_ptr<T> to a new slot, or nullptr if it cannot make one.
+     * @param adopt Called with a slot that is taken over, while the slots are locked.
+     * @return The slot, or nullptr if there is none to take over and none could be made, or the thread is exiting.
+     */
+    template <typename Create, typename Adopt>
+    [[nodiscard]] T* local(Create&& create, Adopt&& adopt) const noexcept;
+
+    /**
+     * Returns the calling thread's slot, taking over slots as they were left, see local.
+     * @param create Returns a std::shared_ptr<T> to a new slot, or nullptr if it cannot make one.
+     */
+    template <typename Create>
+    [[nodiscard]] T* local(Create&& create) const noexcept;
+
+    /**
+     * Returns the lock that guards the slots.
+     */
+    [[nodiscard]] std::mutex& mutex() const noexcept;
+
+    /**
+     * Returns the slots of every thread, which may only be used while holding mutex().
+     * Slots may be removed, e.g. once they are abandoned and hold nothing worth keeping.
+     */
+    [[nodiscard]] std::vector<std::shared_ptr<T>>& slots() const noexcept;
+
+private:
+    struct CachedSlot
+    {
+        std::uint64_t owner_id;
+        std::shared_ptr<T> slot;
+    };
+
+    struct ThreadSlots
+    {
+        ~ThreadSlots() noexcept;
+
+        // The last slot used, so a thread that only uses one owner finds it without a search.
+        std::uint64_t last_id = 0;
+        T* last               = nullptr;
+        std::vector<CachedSlot> slots;
+    };
+
+    [[nodiscard]] static ThreadSlots& thread_slots() noexcept;
+    // Set once the thread's slots have been let go of, it is trivially destructible so it can still be read after that.
+    [[nodiscard]] static bool& exited() noexcept;
+
+    inline static std::atomic<std::uint64_t> s_next_id = 1;
+
+    // Tells the slots of different owners apart in each thread's list, even if one is constructed where another was.
+    std::uint64_t m_id;
+
+    mutable std::mutex m_mutex;
+    mutable std::vector<std::shared_ptr<T>> m_slots;
+};
+
+inline bool ThreadSlot::owned() const noexcept
+{
+    return m_owner.load(std::memory_order_relaxed) == this_thread();
+}
+
+inline bool ThreadSlot::abandoned() const noexcept
+{
+    return m_owner.load(std::memory_order_acquire) == nullptr;
+}
+
+inline const void* ThreadSlot::this_thread() noexcept
+{
+    thread_local const char t_token = 0;
+    return &t_token;
+}
+
+template <typename T>
+ThreadLocalSlots<T>::ThreadLocalSlots() noexcept
+    : m_id(s_next_id.fetch_add(1, std::memory_order_relaxed))
+{
+    static_assert(std::is_base_of_v<ThreadSlot, T>, "Slots must derive from ThreadSlot");
+}
+
+template <typename T>
+template <typename Create, typename Adopt>
+T* ThreadLocalSlots<T>::local(Create&& create, Adopt&& adopt) const noexcept
+{
+    // Destroyed thread locals must not be touched, which the thread's slots are by the time this is set.
+    if (exited())
+        return nullptr;
+
+    ThreadSlots& thread = thread_slots();
+
+    if (thread.last_id == m_id)
+        return thread.last;
+
+    for (const CachedSlot& cached : thread.slots)
+    {
+        if (cached.owner_id == m_id)
+        {
+            thread.last_id = m_id;
+            thread.last    = cached.slot.get();
+            return cached.slot.get();
+        }
+    }
+
+    try
+    {
+        std::shared_ptr<T> slot;
+        {
+            std::lock_guard lock(m_mutex);
+
+            for (const std::shared_ptr<T>& abandoned : m_slots)
+            {
+                const void* expected = nullptr;
+                if (abandoned->m_owner.compare_exchange_strong(expected, ThreadSlot::this_thread(), std::memory_order_acquire))
+                {
+                    adopt(*abandoned);
+                    slot = abandoned;
+                    break;
+                }
+            }
+
+            if (slot == nullptr)
+            {
+                slot = create();
+                if (slot == nullptr)
+                    return nullptr;
+
+                slot->m_owner.store(ThreadSlot::this_thread(), std::memory_order_relaxed);
+                m_slots.push_back(slot);
+            }
+        }
+
+        // Slots of owners that have since been destroyed are the only ones nobody else holds on to.
+        std::erase_if(thread.slots, [](const CachedSlot& cached) { return cached.slot.use_count() == 1; });
+        thread.slots.push_back({m_id, slot});
+
+        thread.last_id = m_id;
+        thread.last    = slot.get();
+        return slot.get();
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+template <typename T>
+template <typename Create>
+T* ThreadLocalSlots<T>::local(Create&& create) const noexcept
+{
+    return local(std::forward<Create>(create), [](T&) noexcept {});
+}
+
+template <typename T>
+std::mutex& ThreadLocalSlots<T>::mutex() const noexcept
+{
+    return m_mutex;
+}
+
+template <typename T>
+std::vector<std::shared_ptr<T>>& ThreadLocalSlots<T>::slots() const noexcept
+{
+    return m_slots;
+}
+
+template <typename T>
+ThreadLocalSlots<T>::ThreadSlots::~ThreadSlots() noexcept
+{
+    exited() = true;
+    for (const CachedSlot& cached : slots)
+        cached.slot->m_owner.store(nullptr, std::memory_order_release);
+}
+
+template <typename T>
+typename ThreadLocalSlots<T>::ThreadSlots& ThreadLocalSlots<T>::thread_slots() noexcept
+{
+    thread_local ThreadSlots t_slots;
+    return t_slots;
+}
+
+template <typename T>
+bool& ThreadLocalSlots<T>::exited() noexcept
+{
+    thread_local bool t_exited = false;
+    return t_exited;
+}
+} // isc::util
@@ -0,0 +1,65 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace isc::util
+{
+/**
+ * Formats timestamps as UTC ISO 8601, e.g. "2026-10-16T12:34:56.123456789Z".
+ * Each thread keeps the date, hour and minute of the last timestamp it formatted,
+ * so consecutive timestamps only have their seconds and fraction rendered.
+ */
+class TimestampFormatter
+{
+public:
+    // The amount of digits after the seconds.
+    enum class Precision : std::uint8_t
+    {
+        Seconds      = 0,
+        Milliseconds = 3,
+        Microseconds = 6,
+        Nanoseconds  = 9
+    };
+
+    static constexpr std::size_t max_size = 30;
+
+    /**
+     * @param precision The amount of digits after the seconds.
+     */
+    explicit TimestampFormatter(Precision precision = Precision::Nanoseconds) noexcept;
+
+    /**
+     * Formats a timestamp into a buffer of at least max_size characters, without a terminator.
+     * @param timestamp The time in nanoseconds since the Unix epoch.
+     * @param out The buffer to format into.
+     * @return The amount of characters written.
+     */
+    std::size_t format(std::uint64_t timestamp, char* out) const noexcept;
+
+    /**
+     * Formats a timestamp like format, without reading or updating the thread's cache, so it is safe in signal handlers.
+     * @param timestamp The time in nanoseconds since the Unix epoch.
+     * @param out The buffer to format into.
+     * @return The amount of characters written.
+     */
+    std::size_t format_uncached(std::uint64_t timestamp, char* out) const noexcept;
+
+    /**
+     * Appends a formatted timestamp to a string.
+     * @param timestamp The time in nanoseconds since the Unix epoch.
+     * @param out The string to append to.
+     */
+    void append(std::uint64_t timestamp, std::string& out) const;
+
+private:
+    std::size_t format_seconds(std::uint64_t timestamp, char* out) const noexcept;
+
+    Precision m_precision = Precision::Nanoseconds;
+};
+} // isc::util
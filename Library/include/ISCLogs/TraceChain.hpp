@@ -0,0 +1,112 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+
+namespace isc::util
+{
+class MemoryPool;
+
+/**
+ * An append-only sequence of trace frames, stored back to back in a single reference counted block.
+ * Copies share the block, and a copy that appends to the end of what it shares grows the block in place,
+ * so passing a message up through a call stack and adding a frame at every level allocates only when the block fills up.
+ * Appending to a copy that is no longer at the end of the block copies its frames into a new block first.
+ */
+class TraceChain
+{
+public:
+    /**
+     * Iterates over the frames of a chain, in the order they were appended.
+     */
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::string_view;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = std::string_view;
+
+        Iterator() noexcept = default;
+
+        [[nodiscard]] std::string_view operator*() const noexcept;
+        Iterator& operator++() noexcept;
+        Iterator operator++(int) noexcept;
+
+        [[nodiscard]] bool operator==(const Iterator& other) const noexcept = default;
+
+    private:
+        friend class TraceChain;
+
+        explicit Iterator(const char* position) noexcept;
+
+        const char* m_position = nullptr;
+    };
+
+    TraceChain() noexcept = default;
+
+    /**
+     * Constructs an empty chain whose blocks are allocated from a pool instead of the global heap.
+     * Copies of the chain keep allocating from the same pool.
+     * @param pool The pool to allocate from, it must outlive every copy of the chain.
+     */
+    explicit TraceChain(MemoryPool& pool) noexcept;
+    ~TraceChain() noexcept;
+
+    TraceChain(const TraceChain& chain) noexcept;
+    TraceChain& operator=(const TraceChain& chain) noexcept;
+
+    TraceChain(TraceChain&& chain) noexcept;
+    TraceChain& operator=(TraceChain&& chain) noexcept;
+
+    /**
+     * Appends a frame to the end of the chain.
+     * If the frame cannot be stored because memory is exhausted, it is dropped.
+     * @param frame The frame to append.
+     */
+    void append(std::string_view frame) noexcept;
+
+    /**
+     * Returns the amount of frames in the chain.
+     */
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /**
+     * Returns whether the chain holds no frames.
+     */
+    [[nodiscard]] bool empty() const noexcept;
+
+    [[nodiscard]] Iterator begin() const noexcept;
+    [[nodiscard]] Iterator end() const noexcept;
+
+private:
+    struct Block
+    {
+        std::atomic<std::size_t> references;
+        // The end of the frames written to the block so far, by any of the chains sharing it.
+        std::atomic<std::size_t> used;
+        std::size_t capacity;
+        // Whether the block came from a MemoryPool rather than the global heap.
+        bool pooled;
+        char data[1];
+    };
+
+    static constexpr std::size_t s_min_capacity = 256;
+
+    [[nodiscard]] static Block* allocate(std::size_t capacity, MemoryPool* pool) noexcept;
+    void release() noexcept;
+
+    Block* m_block       = nullptr;
+    std::uint32_t m_size = 0;
+    std::size_t m_used   = 0;
+    MemoryPool* m_pool   = nullptr;
+};
+} // isc::util
@@ -0,0 +1,473 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "AsyncLogger.hpp"
+
+#include "CrashHandler.hpp"
+#include "Metrics.hpp"
+#include "SignalWriter.hpp"
+
+#include <string>
+
+namespace isc
+{
+AsyncLogger::AsyncLogger(Logger& sink, const std::size_t capacity, const OverflowPolicy policy) noexcept
+    : Logger(Message::Severity::Debug),
+      m_sink(sink),
+      m_policy(policy),
+      m_queue(capacity)
+{
+    if (!m_queue.valid())
+    {
+        m_closed.store(true, std::memory_order_relaxed);
+        return;
+    }
+
+    CrashHandler::watch(*this);
+
+    try
+    {
+        m_worker = std::thread(&AsyncLogger::run, this);
+    }
+    catch (...)
+    {
+        // Without a worker every message is logged synchronously, see log_message_internal.
+        m_closed.store(true, std::memory_order_relaxed);
+    }
+}
+
+AsyncLogger::~AsyncLogger() noexcept
+{
+    CrashHandler::unwatch(*this);
+    shutdown();
+}
+
+void AsyncLogger::flush() noexcept
+{
+    if (m_closed.load(std::memory_order_acquire))
+    {
+        drain();
+        return;
+    }
+
+    const std::uint64_t target = m_queue.push_count();
+    std::uint64_t processed    = m_processed.load(std::memory_order_acquire);
+    while (processed < target)
+    {
+        m_processed.wait(processed, std::memory_order_acquire);
+        processed = m_processed.load(std::memory_order_acquire);
+    }
+}
+
+void AsyncLogger::shutdown() noexcept
+{
+    if (m_worker.joinable())
+    {
+        m_stopping.store(true, std::memory_order_release);
+        {
+            std::lock_guard lock(m_mutex);
+            m_sleeping.store(false, std::memory_order_relaxed);
+        }
+        m_wake.notify_one();
+        m_worker.join();
+
+        // Pairs with the fence in notify_worker, so that a producer racing with the shutdown either sees the logger closed,
+        // or its record is seen by the drain below.
+        m_closed.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    drain();
+}
+
+std::uint64_t AsyncLogger::dropped() const noexcept
+{
+    return m_dropped.load(std::memory_order_relaxed);
+}
+
+void AsyncLogger::set_metrics(Metrics* metrics) noexcept
+{
+    m_metrics.store(metrics, std::memory_order_relaxed);
+}
+
+void AsyncLogger::log_message_internal(const Message& message) const noexcept
+{
+    // Queued even while shutting down, as the worker may still be draining records that came before this one.
+    if (m_closed.load(std::memory_order_acquire))
+    {
+        std::lock_guard lock(m_sink_mutex);
+        m_sink.log_message(message);
+        return;
+    }
+
+    enqueue(Record(message));
+}
+
+void AsyncLogger::log_record_internal(const Record& record) const noexcept
+{
+    if (m_closed.load(std::memory_order_acquire))
+    {
+        std::lock_guard lock(m_sink_mutex);
+        m_sink.log_record(record);
+        return;
+    }
+
+    // The caller keeps ownership of its record, so the queued copy needs its own spill storage.
+    enqueue(record.clone());
+}
+
+void AsyncLogger::dump_pending_internal(util::SignalWriter& writer) const noexcept
+{
+    // The sink may be holding a lock that the crashed thread will never release, so records are written out directly.
+    // They are not released either, freeing is not async-signal-safe and the process is about to end anyway.
+    Record record;
+    while (m_queue.try_pop(record))
+        writer.write_record(record);
+}
+
+void AsyncLogger::enqueue(Record record) const noexcept
+{
+    if (try_enqueue(record))
+        return;
+
+    push_blocking(record);
+    notify_worker();
+}
+
+bool AsyncLogger::try_enqueue(Record& record) const noexcept
+{
+    bool queued = m_queue.try_push(record);
+    if (!queued)
+    {
+        if (m_policy == OverflowPolicy::Block || record.severity() == Message::Severity::Fatal)
+            return false;
+
+        if (m_policy == OverflowPolicy::DropOldest)
+            queued = push_dropping_oldest(record);
+        else
+            count_dropped();
+    }
+
+    if (!queued)
+    {
+        record.release();
+        return true;
+    }
+
+    notify_worker();
+    return true;
+}
+
+void AsyncLogger::notify_worker() const noexcept
+{
+    // Pairs with the fence in run() so that either we see the worker asleep, or it sees our record.
+    // Likewise with the one in shutdown(), if the final drain may have missed our record, we drain it ourselves.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_closed.load(std::memory_order_relaxed))
+        drain_queue();
+    else if (m_sleeping.load(std::memory_order_relaxed))
+        wake();
+}
+
+bool AsyncLogger::try_log(Record& record) const noexcept
+{
+    if (!should_log(record.severity()))
+    {
+        record.release();
+        return true;
+    }
+
+    // Queued even while shutting down, as the worker may still be draining records that came before this one.
+    if (m_closed.load(std::memory_order_acquire))
+    {
+        {
+            std::lock_guard lock(m_sink_mutex);
+            m_sink.log_record(record);
+        }
+        record.release();
+        return true;
+    }
+
+    return try_enqueue(record);
+}
+
+bool AsyncLogger::wait(Waiter& waiter) const noexcept
+{
+    {
+        std::lock_guard lock(m_waiters_mutex);
+
+        // Checked under the lock, so that the final drain either sees the waiter, or the waiter sees the drain.
+        // While the worker is still draining at shutdown, records wait their turn like usual to stay in order.
+        if (m_closed.load(std::memory_order_acquire))
+        {
+            if (waiter.record != nullptr)
+            {
+                {
+                    std::lock_guard sink_lock(m_sink_mutex);
+                    m_sink.log_record(*waiter.record);
+                }
+                waiter.record->release();
+            }
+            return false;
+        }
+
+        // Counted before looking, pairs with the worker counting its progress before looking for waiters, so either it
+        // sees this waiter, or this waiter sees its progress.
+        m_waiter_count.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (waiter.record != nullptr ? m_queue.try_push(*waiter.record) : m_processed.load(std::memory_order_acquire) >= waiter.target)
+        {
+            m_waiter_count.fetch_sub(1, std::memory_order_relaxed);
+            if (waiter.record != nullptr)
+                notify_worker();
+            return false;
+        }
+
+        waiter.next = nullptr;
+        if (m_last_waiter != nullptr)
+            m_last_waiter->next = &waiter;
+        else
+            m_waiters = &waiter;
+        m_last_waiter = &waiter;
+    }
+
+    // The worker may be asleep on a queue that only just filled up, make sure it is draining.
+    if (m_sleeping.load(std::memory_order_relaxed))
+        wake();
+
+    return true;
+}
+
+void AsyncLogger::complete_waiters(const bool all) const noexcept
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!all && m_waiter_count.load(std::memory_order_relaxed) == 0)
+        return;
+
+    Waiter* completed = nullptr;
+    Waiter* last      = nullptr;
+    {
+        std::lock_guard lock(m_waiters_mutex);
+
+        const std::uint64_t processed = m_processed.load(std::memory_order_acquire);
+        Waiter* previous              = nullptr;
+        for (Waiter* waiter = m_waiters; waiter != nullptr;)
+        {
+            Waiter* next = waiter->next;
+
+            // Records still waiting after the final drain are logged below instead of queued, nothing drains the queue anymore.
+            // Until then they are queued, even while shutting down, so they are not logged ahead of older records.
+            const bool done = waiter->record != nullptr ? all || m_queue.try_push(*waiter->record) : all || processed >= waiter->target;
+            if (!done)
+            {
+                previous = waiter;
+                waiter   = next;
+                continue;
+            }
+
+            (previous != nullptr ? previous->next : m_waiters) = next;
+            if (m_last_waiter == waiter)
+                m_last_waiter = previous;
+            m_waiter_count.fetch_sub(1, std::memory_order_relaxed);
+
+            // Only the records that were not queued are left set.
+            if (!all)
+                waiter->record = nullptr;
+
+            waiter->next                               = nullptr;
+            (last != nullptr ? last->next : completed) = waiter;
+            last                                       = waiter;
+            waiter                                     = next;
+        }
+    }
+
+    // A completed waiter may be gone as soon as its complete function returns, e.g. if it resumes a coroutine inline.
+    for (Waiter* waiter = completed; waiter != nullptr;)
+    {
+        Waiter* next = waiter->next;
+        if (waiter->record != nullptr)
+        {
+            {
+                std::lock_guard lock(m_sink_mutex);
+                m_sink.log_record(*waiter->record);
+            }
+            waiter->record->release();
+        }
+
+        waiter->complete(*waiter);
+        waiter = next;
+    }
+}
+
+void AsyncLogger::run() noexcept
+{
+    Record record;
+
+    while (true)
+    {
+        // Sampled once per batch, which is cheap enough to leave on, and still sees the queue at its fullest under load.
+        if (Metrics* metrics = m_metrics.load(std::memory_order_relaxed); metrics != nullptr)
+            metrics->set_queue_depth(m_queue.push_count() - m_processed.load(std::memory_order_relaxed));
+
+        std::uint64_t processed = 0;
+        {
+            // Held for the whole batch, only records rescued from being dropped are logged by other threads meanwhile.
+            std::lock_guard lock(m_sink_mutex);
+            while (processed < s_batch_size && m_queue.try_pop(record))
+            {
+                m_sink.log_record(record);
+                record.release();
+                ++processed;
+            }
+        }
+
+        if (processed > 0)
+        {
+            m_processed.fetch_add(processed, std::memory_order_release);
+            m_processed.notify_all();
+            complete_waiters(false);
+            continue;
+        }
+
+        report_dropped();
+        // Dropping the oldest messages also counts as progress, without the worker having logged anything.
+        complete_waiters(false);
+
+        std::unique_lock lock(m_mutex);
+        m_sleeping.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (!m_queue.empty())
+        {
+            m_sleeping.store(false, std::memory_order_relaxed);
+            continue;
+        }
+
+        if (m_stopping.load(std::memory_order_acquire))
+            break;
+
+        m_wake.wait(lock, [this] { return !m_sleeping.load(std::memory_order_relaxed); });
+    }
+
+    m_sleeping.store(false, std::memory_order_relaxed);
+}
+
+void AsyncLogger::drain() noexcept
+{
+    drain_queue();
+    report_dropped();
+
+    // Completed outside the lock, a waiter may resume a coroutine inline that flushes again.
+    complete_waiters(true);
+}
+
+void AsyncLogger::drain_queue() const noexcept
+{
+    Record record;
+    std::uint64_t processed = 0;
+    {
+        std::lock_guard lock(m_sink_mutex);
+        while (m_queue.try_pop(record))
+        {
+            m_sink.log_record(record);
+            record.release();
+            ++processed;
+        }
+    }
+
+    if (processed > 0)
+    {
+        m_processed.fetch_add(processed, std::memory_order_release);
+        m_processed.notify_all();
+    }
+}
+
+void AsyncLogger::report_dropped() const noexcept
+{
+    // Whoever moves the reported count up to the dropped one owns the difference, so no drop is reported twice.
+    const std::uint64_t dropped = m_dropped.load(std::memory_order_relaxed);
+    std::uint64_t reported      = m_reported_dropped.load(std::memory_order_relaxed);
+    do
+    {
+        if (reported >= dropped)
+            return;
+    }
+    while (!m_reported_dropped.compare_exchange_weak(reported, dropped, std::memory_order_relaxed));
+
+    const std::uint64_t count = dropped - reported;
+
+    try
+    {
+        std::lock_guard lock(m_sink_mutex);
+        m_sink.log_message(WarningMessage(
+            0,
+            "Messages Dropped",
+            std::to_string(count) + " messages were dropped because the asynchronous logger's queue was full."
+        ));
+    }
+    catch (...)
+    {
+        // Reporting is best effort, the count is still available through dropped().
+    }
+}
+
+void AsyncLogger::count_dropped() const noexcept
+{
+    m_dropped.fetch_add(1, std::memory_order_relaxed);
+    if (Metrics* metrics = m_metrics.load(std::memory_order_relaxed); metrics != nullptr)
+        metrics->count_dropped(1);
+}
+
+void AsyncLogger::wake() const noexcept
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_sleeping.store(false, std::memory_order_relaxed);
+    }
+    m_wake.notify_one();
+}
+
+bool AsyncLogger::push_blocking(const Record& record) const noexcept
+{
+    while (true)
+    {
+        const std::uint64_t processed = m_processed.load(std::memory_order_acquire);
+        if (m_queue.try_push(record))
+            return true;
+
+        // The worker may be asleep on a queue that only just filled up, make sure it is draining.
+        if (m_sleeping.load(std::memory_order_relaxed))
+            wake();
+
+        m_processed.wait(processed, std::memory_order_acquire);
+    }
+}
+
+bool AsyncLogger::push_dropping_oldest(const Record& record) const noexcept
+{
+    Record oldest;
+    while (!m_queue.try_push(record))
+    {
+        if (!m_queue.try_pop(oldest))
+            continue;
+
+        // Fatal messages are never dropped, one in the way is logged here instead, just ahead of whatever the worker has
+        // picked up meanwhile.
+        if (oldest.severity() == Message::Severity::Fatal)
+        {
+            std::lock_guard lock(m_sink_mutex);
+            m_sink.log_record(oldest);
+        }
+        else
+            count_dropped();
+
+        oldest.release();
+        m_processed.fetch_add(1, std::memory_order_release);
+        m_processed.notify_all();
+    }
+
+    return true;
+}
+} // isc
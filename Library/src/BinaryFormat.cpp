@@ -0,0 +1,187 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "BinaryFormat.hpp"
+
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace isc::binary
+{
+std::string Entry::message() const
+{
+    std::string out;
+    format_to(out);
+    return out;
+}
+
+void Entry::format_to(std::string& out) const
+{
+    out += '[';
+    out += Message::severity_name(severity);
+    out += "]: ";
+    out += name;
+    if (!has_description)
+        return;
+
+    out += " - ";
+    if (!deferred)
+    {
+        out += description;
+        return;
+    }
+
+    const std::size_t size = out.size();
+    try
+    {
+        util::FormatArgs::render(description, arguments, out);
+    }
+    catch (const std::bad_alloc&)
+    {
+        throw;
+    }
+    catch (...)
+    {
+        out.resize(size);
+        out += description;
+    }
+}
+
+Reader::Reader(const std::string& path) noexcept
+{
+    const int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file == -1)
+        return;
+
+    struct stat status{};
+    if (::fstat(file, &status) == 0 && static_cast<std::size_t>(status.st_size) >= sizeof(SegmentHeader))
+    {
+        void* data = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        if (data != MAP_FAILED)
+        {
+            m_data = static_cast<const std::byte*>(data);
+            m_size = static_cast<std::size_t>(status.st_size);
+            ::madvise(data, m_size, MADV_SEQUENTIAL);
+        }
+    }
+
+    ::close(file);
+
+    if (m_data == nullptr)
+        return;
+
+    SegmentHeader header{};
+    std::memcpy(&header, m_data, sizeof(header));
+    if (std::memcmp(header.magic, magic, sizeof(magic)) != 0 || header.version != version || header.header_size < sizeof(header)
+        || header.header_size > m_size)
+    {
+        ::munmap(const_cast<std::byte*>(m_data), m_size);
+        m_data = nullptr;
+        return;
+    }
+
+    m_offset = header.header_size;
+}
+
+Reader::~Reader() noexcept
+{
+    if (m_data != nullptr)
+        ::munmap(const_cast<std::byte*>(m_data), m_size);
+}
+
+bool Reader::is_open() const noexcept
+{
+    return m_data != nullptr;
+}
+
+bool Reader::next(Entry& entry)
+{
+    while (m_data != nullptr && m_size - m_offset >= sizeof(EntryHeader))
+    {
+        EntryHeader header{};
+        std::memcpy(&header, m_data + m_offset, sizeof(header));
+        if (header.size < sizeof(header) || header.size > m_size - m_offset)
+            return false;
+
+        const std::byte* body  = m_data + m_offset + sizeof(header);
+        const std::size_t size = header.size - sizeof(header);
+        m_offset += header.size;
+
+        if (header.kind == EntryKind::String)
+        {
+            std::uint32_t id = 0;
+            if (size < sizeof(id))
+                continue;
+
+            std::memcpy(&id, body, sizeof(id));
+            m_strings[id] = {reinterpret_cast<const char*>(body + sizeof(id)), size - sizeof(id)};
+            continue;
+        }
+
+        RecordFields fields{};
+        if (header.kind != EntryKind::Record || size < sizeof(fields))
+            continue;
+
+        std::memcpy(&fields, body, sizeof(fields));
+        if (fields.description_size > size - sizeof(fields))
+            continue;
+
+        entry.timestamp       = fields.timestamp;
+        entry.thread_id       = fields.thread_id;
+        entry.code            = fields.code;
+        entry.severity        = static_cast<Message::Severity>(fields.severity);
+        entry.has_description = (header.flags & HasDescription) != 0;
+        entry.deferred        = (header.flags & Deferred) != 0;
+        entry.truncated       = (header.flags & Truncated) != 0;
+        entry.line            = fields.line;
+        entry.column          = fields.column;
+        entry.file            = string(fields.file_id);
+        entry.function        = string(fields.function_id);
+        entry.name            = string(fields.name_id);
+
+        const std::byte* description = body + sizeof(fields);
+        if (entry.deferred)
+        {
+            entry.description = string(fields.format_id);
+            entry.arguments   = {description, fields.description_size};
+        }
+        else
+        {
+            entry.description = {reinterpret_cast<const char*>(description), fields.description_size};
+            entry.arguments   = {};
+        }
+
+        entry.trace.clear();
+        std::size_t offset = sizeof(fields) + fields.description_size;
+        for (std::uint16_t i = 0; i < header.trace_size; ++i)
+        {
+            std::uint32_t frame_size = 0;
+            if (size - offset < sizeof(frame_size))
+                break;
+
+            std::memcpy(&frame_size, body + offset, sizeof(frame_size));
+            offset += sizeof(frame_size);
+            if (size - offset < frame_size)
+                break;
+
+            entry.trace.emplace_back(reinterpret_cast<const char*>(body + offset), frame_size);
+            offset += frame_size;
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+std::string_view Reader::string(const std::uint32_t id) const noexcept
+{
+    const auto found = m_strings.find(id);
+    return found == m_strings.end() ? std::string_view() : found->second;
+}
+} // isc::binary
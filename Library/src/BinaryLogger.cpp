@@ -0,0 +1,292 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "BinaryLogger.hpp"
+
+#include "InternTable.hpp"
+#include "Metrics.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace isc
+{
+namespace
+{
+std::size_t string_entry_size(const std::string_view string) noexcept
+{
+    return sizeof(binary::EntryHeader) + sizeof(std::uint32_t) + string.size();
+}
+}
+
+BinaryLogger::BinaryLogger(std::string path, const std::size_t segment_size, const Message::Severity threshold) noexcept
+    : Logger(threshold),
+      m_path(std::move(path)),
+      m_segment_size(std::max(segment_size, sizeof(binary::SegmentHeader) + 4096))
+{
+    std::lock_guard lock(m_mutex);
+    open_segment();
+}
+
+BinaryLogger::~BinaryLogger() noexcept
+{
+    std::lock_guard lock(m_mutex);
+    close_segment();
+}
+
+void BinaryLogger::flush() noexcept
+{
+    std::lock_guard lock(m_mutex);
+    if (m_data != nullptr)
+        ::msync(m_data, m_used, MS_ASYNC);
+}
+
+bool BinaryLogger::is_open() const noexcept
+{
+    std::lock_guard lock(m_mutex);
+    return m_data != nullptr;
+}
+
+void BinaryLogger::set_metrics(Metrics* metrics) noexcept
+{
+    m_metrics.store(metrics, std::memory_order_relaxed);
+}
+
+void BinaryLogger::log_message_internal(const Message& message) const noexcept
+{
+    Record record(message);
+    write(record);
+    record.release();
+}
+
+void BinaryLogger::log_record_internal(const Record& record) const noexcept
+{
+    write(record);
+}
+
+void BinaryLogger::write(const Record& record) const noexcept
+{
+    const std::source_location& location = record.location();
+    const std::string_view description   = record.deferred() ? std::string_view(reinterpret_cast<const char*>(record.arguments().data()), record.arguments().size())
+                                                             : record.has_description() ? record.description() : std::string_view();
+
+    std::size_t size = sizeof(binary::EntryHeader) + sizeof(binary::RecordFields) + description.size();
+    for (std::size_t i = 0; i < record.trace_size(); ++i)
+        size += sizeof(std::uint32_t) + record.trace(i).size();
+
+    // Room is made for every string the record refers to, in case this is the first time the segment sees them.
+    const std::size_t strings = string_entry_size(location.file_name()) + string_entry_size(location.function_name())
+                                + string_entry_size(record.name())
+                                + (record.deferred() ? string_entry_size(record.description()) : 0);
+
+    std::lock_guard lock(m_mutex);
+    if (!reserve(size + strings))
+        return;
+
+    // Counts the strings the record is the first to refer to along with the record itself.
+    const std::size_t used = m_used;
+
+    binary::RecordFields fields{};
+    fields.timestamp        = record.timestamp();
+    fields.thread_id        = record.thread_id();
+    fields.code             = record.code();
+    fields.line             = location.line();
+    fields.column           = location.column();
+    fields.file_id          = intern(location.file_name());
+    fields.function_id      = intern(location.function_name());
+    fields.name_id          = intern(record.name_id());
+    if (fields.name_id == binary::no_string)
+        fields.name_id = intern(record.name());
+    fields.format_id        = record.deferred() ? intern(record.description()) : binary::no_string;
+    fields.description_size = static_cast<std::uint32_t>(description.size());
+    fields.severity         = static_cast<std::uint8_t>(record.severity());
+
+    binary::EntryHeader header{};
+    header.size       = static_cast<std::uint32_t>(size);
+    header.kind       = binary::EntryKind::Record;
+    header.flags      = (record.has_description() ? binary::HasDescription : 0)
+                        | (record.deferred() ? binary::Deferred : 0)
+                        | (record.truncated() ? binary::Truncated : 0);
+    header.trace_size = static_cast<std::uint16_t>(record.trace_size());
+
+    // The header is written last, so a partially written entry still reads as the end of the segment.
+    const std::size_t start = m_used;
+    m_used += sizeof(header);
+    append(&fields, sizeof(fields));
+    append(description.data(), description.size());
+    for (std::size_t i = 0; i < record.trace_size(); ++i)
+    {
+        const std::string_view frame = record.trace(i);
+        const auto frame_size        = static_cast<std::uint32_t>(frame.size());
+        append(&frame_size, sizeof(frame_size));
+        append(frame.data(), frame.size());
+    }
+
+    std::memcpy(m_data + start, &header, sizeof(header));
+
+    if (Metrics* metrics = m_metrics.load(std::memory_order_relaxed); metrics != nullptr)
+        metrics->count_bytes(m_used - used);
+}
+
+bool BinaryLogger::reserve(const std::size_t size) const noexcept
+{
+    if (m_data != nullptr && m_segment_size - m_used >= size)
+        return true;
+
+    if (size > m_segment_size - sizeof(binary::SegmentHeader))
+        return false;
+
+    close_segment();
+    return open_segment();
+}
+
+bool BinaryLogger::open_segment() const noexcept
+{
+    try
+    {
+        std::string path;
+        do
+            path = m_path + '.' + std::to_string(m_segment_index++);
+        while (::access(path.c_str(), F_OK) == 0);
+
+        m_file = ::open(path.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    }
+    catch (...)
+    {
+        return false;
+    }
+
+    if (m_file == -1)
+        return false;
+
+    void* data = MAP_FAILED;
+    if (::ftruncate(m_file, static_cast<off_t>(m_segment_size)) == 0)
+        data = ::mmap(nullptr, m_segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_file, 0);
+
+    if (data == MAP_FAILED)
+    {
+        ::close(m_file);
+        m_file = -1;
+        return false;
+    }
+
+    m_data = static_cast<std::byte*>(data);
+    m_used = 0;
+    m_strings.clear();
+    m_static_strings.clear();
+    m_next_id = s_local_id;
+    try
+    {
+        m_written_global.assign(util::InternTable::max_strings + 1, false);
+    }
+    catch (...)
+    {
+        m_written_global.clear();
+    }
+
+    binary::SegmentHeader header{};
+    std::memcpy(header.magic, binary::magic, sizeof(binary::magic));
+    header.version     = binary::version;
+    header.header_size = sizeof(header);
+    header.capacity    = m_segment_size;
+    append(&header, sizeof(header));
+    return true;
+}
+
+void BinaryLogger::close_segment() const noexcept
+{
+    if (m_data == nullptr)
+        return;
+
+    ::munmap(m_data, m_segment_size);
+    m_data = nullptr;
+
+    // Trim the unused part of the segment, the end of the file marks the end of the records.
+    ::ftruncate(m_file, static_cast<off_t>(m_used));
+    ::close(m_file);
+    m_file = -1;
+}
+
+std::uint32_t BinaryLogger::intern(const std::uint32_t global_id) const noexcept
+{
+    if (global_id == util::InternTable::no_id || global_id >= m_written_global.size())
+        return binary::no_string;
+
+    if (!m_written_global[global_id])
+    {
+        append_string(global_id, util::InternTable::global().lookup(global_id));
+        m_written_global[global_id] = true;
+    }
+
+    return global_id;
+}
+
+std::uint32_t BinaryLogger::intern(const std::string_view string) const noexcept
+{
+    try
+    {
+        const auto found = m_strings.find(string);
+        if (found != m_strings.end())
+            return found->second;
+
+        const std::uint32_t id = m_next_id++;
+        m_strings.emplace(string, id);
+        append_string(id, string);
+        return id;
+    }
+    catch (...)
+    {
+        return binary::no_string;
+    }
+}
+
+std::uint32_t BinaryLogger::intern(const char* string) const noexcept
+{
+    // Source locations hand out the same pointers every time, which the global table looks up without hashing their contents.
+    const std::uint32_t global_id = intern(util::InternTable::global().intern_static(string));
+    if (global_id != binary::no_string)
+        return global_id;
+
+    const auto found = m_static_strings.find(string);
+    if (found != m_static_strings.end())
+        return found->second;
+
+    const std::uint32_t id = intern(std::string_view(string));
+    try
+    {
+        if (id != binary::no_string)
+            m_static_strings.emplace(string, id);
+    }
+    catch (...)
+    {}
+
+    return id;
+}
+
+void BinaryLogger::append_string(const std::uint32_t id, const std::string_view string) const noexcept
+{
+    binary::EntryHeader header{};
+    header.size = static_cast<std::uint32_t>(string_entry_size(string));
+    header.kind = binary::EntryKind::String;
+
+    const std::size_t start = m_used;
+    m_used += sizeof(header);
+    append(&id, sizeof(id));
+    append(string.data(), string.size());
+    std::memcpy(m_data + start, &header, sizeof(header));
+}
+
+void BinaryLogger::append(const void* data, const std::size_t size) const noexcept
+{
+    if (size == 0)
+        return;
+
+    std::memcpy(m_data + m_used, data, size);
+    m_used += size;
+}
+} // isc
@@ -0,0 +1,188 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "Clock.hpp"
+
+#include <atomic>
+#include <mutex>
+
+#if defined(__linux__)
+#include <time.h>
+#endif
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <cpuid.h>
+#include <x86intrin.h>
+#define ISCLOGS_CLOCK_TSC 1
+#endif
+
+namespace isc
+{
+namespace
+{
+std::atomic<Clock::Source> s_source = Clock::Source::Realtime;
+
+std::uint64_t realtime_now() noexcept
+{
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+    ).count());
+}
+
+std::uint64_t coarse_now() noexcept
+{
+#if defined(__linux__)
+    timespec time{};
+    if (clock_gettime(CLOCK_REALTIME_COARSE, &time) == 0)
+        return static_cast<std::uint64_t>(time.tv_sec) * 1'000'000'000ull + static_cast<std::uint64_t>(time.tv_nsec);
+#endif
+
+    return realtime_now();
+}
+
+std::uint64_t steady_now() noexcept
+{
+    const auto steady = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()
+    ).count());
+
+    static const std::uint64_t s_offset = realtime_now() - steady;
+    return steady + s_offset;
+}
+
+#if defined(ISCLOGS_CLOCK_TSC)
+/**
+ * Converts time stamp counter ticks to wall clock time, from the last point the two were read together.
+ * Readers never lock, the calibrating thread publishes a new calibration through a sequence lock,
+ * and any thread that reads the clock while a calibration is being published uses the wall clock instead.
+ */
+struct TscCalibration
+{
+    // Odd while a calibration is being published.
+    std::atomic<std::uint64_t> sequence = 0;
+    std::atomic<std::uint64_t> base_tsc = 0;
+    std::atomic<std::uint64_t> base_ns  = 0;
+    // Nanoseconds per tick in 32.32 fixed point, 0 until the first calibration.
+    std::atomic<std::uint64_t> scale = 0;
+    // Ticks until the next calibration.
+    std::atomic<std::uint64_t> period = 0;
+
+    // Only taken by the thread calibrating, others fall back to the wall clock rather than wait.
+    std::mutex mutex;
+    std::uint64_t anchor_tsc = 0;
+    std::uint64_t anchor_ns  = 0;
+};
+
+TscCalibration s_tsc;
+
+// Reads the wall clock, and calibrates the counter against it if no other thread is already doing so.
+std::uint64_t calibrate() noexcept
+{
+    const std::uint64_t tsc = __rdtsc();
+    const std::uint64_t ns  = realtime_now();
+
+    const std::unique_lock lock(s_tsc.mutex, std::try_to_lock);
+    if (!lock.owns_lock())
+        return ns;
+
+    // The first calibration is measured from the first read, later ones from the previous calibration.
+    if (s_tsc.anchor_tsc == 0)
+    {
+        s_tsc.anchor_tsc = tsc;
+        s_tsc.anchor_ns  = ns;
+        return ns;
+    }
+
+    const auto minimum = static_cast<std::uint64_t>(std::chrono::nanoseconds(Clock::min_calibration).count());
+    if (tsc <= s_tsc.anchor_tsc || ns < s_tsc.anchor_ns + minimum)
+        return ns;
+
+    const unsigned __int128 elapsed = ns - s_tsc.anchor_ns;
+    const std::uint64_t scale       = static_cast<std::uint64_t>((elapsed << 32) / (tsc - s_tsc.anchor_tsc));
+    if (scale == 0)
+        return ns;
+
+    const unsigned __int128 period_ns = std::chrono::nanoseconds(Clock::calibration_period).count();
+    const auto period                 = static_cast<std::uint64_t>((period_ns << 32) / scale);
+
+    s_tsc.sequence.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    s_tsc.base_tsc.store(tsc, std::memory_order_relaxed);
+    s_tsc.base_ns.store(ns, std::memory_order_relaxed);
+    s_tsc.scale.store(scale, std::memory_order_relaxed);
+    s_tsc.period.store(period, std::memory_order_relaxed);
+    s_tsc.sequence.fetch_add(1, std::memory_order_release);
+
+    s_tsc.anchor_tsc = tsc;
+    s_tsc.anchor_ns  = ns;
+    return ns;
+}
+
+std::uint64_t tsc_now() noexcept
+{
+    const std::uint64_t sequence = s_tsc.sequence.load(std::memory_order_acquire);
+    const std::uint64_t base_tsc = s_tsc.base_tsc.load(std::memory_order_relaxed);
+    const std::uint64_t base_ns  = s_tsc.base_ns.load(std::memory_order_relaxed);
+    const std::uint64_t scale    = s_tsc.scale.load(std::memory_order_relaxed);
+    const std::uint64_t period   = s_tsc.period.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if ((sequence & 1) != 0 || s_tsc.sequence.load(std::memory_order_relaxed) != sequence)
+        return realtime_now();
+
+    // A counter read on another core can be slightly behind the base, which also lands here.
+    const std::uint64_t ticks = __rdtsc() - base_tsc;
+    if (scale == 0 || ticks >= period)
+        return calibrate();
+
+    return base_ns + static_cast<std::uint64_t>((static_cast<unsigned __int128>(ticks) * scale) >> 32);
+}
+#endif
+} // namespace
+
+std::uint64_t Clock::now() noexcept
+{
+    switch (s_source.load(std::memory_order_relaxed))
+    {
+    case Source::Coarse:
+        return coarse_now();
+    case Source::Steady:
+        return steady_now();
+    case Source::Tsc:
+#if defined(ISCLOGS_CLOCK_TSC)
+        return tsc_now();
+#else
+        return steady_now();
+#endif
+    case Source::Realtime:
+        break;
+    }
+
+    return realtime_now();
+}
+
+void Clock::set_source(const Source source) noexcept
+{
+    s_source.store(source == Source::Tsc && !has_invariant_tsc() ? Source::Steady : source, std::memory_order_relaxed);
+}
+
+Clock::Source Clock::source() noexcept
+{
+    return s_source.load(std::memory_order_relaxed);
+}
+
+bool Clock::has_invariant_tsc() noexcept
+{
+#if defined(ISCLOGS_CLOCK_TSC)
+    static const bool s_invariant = [] {
+        unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+        return __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) != 0 && (edx & (1u << 8)) != 0;
+    }();
+
+    return s_invariant;
+#else
+    return false;
+#endif
+}
+} // isc
@@ -0,0 +1,112 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "ConfigWatcher.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace isc
+{
+ConfigWatcher::ConfigWatcher(std::string path, LoggerRegistry& registry) noexcept
+    : m_path(std::move(path)),
+      m_registry(registry)
+{
+    m_registry.load(m_path);
+
+    std::string directory;
+    try
+    {
+        // Editors usually replace the file instead of writing to it, so the directory is watched instead of the file.
+        const std::size_t separator = m_path.rfind('/');
+        directory                   = separator == std::string::npos ? "." : separator == 0 ? "/" : m_path.substr(0, separator);
+        m_file_name                 = separator == std::string::npos ? m_path : m_path.substr(separator + 1);
+    }
+    catch (...)
+    {
+        return;
+    }
+
+    m_inotify = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    m_wake    = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_inotify == -1 || m_wake == -1 || ::inotify_add_watch(m_inotify, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) == -1)
+    {
+        if (m_inotify != -1)
+            ::close(m_inotify);
+        if (m_wake != -1)
+            ::close(m_wake);
+        m_inotify = m_wake = -1;
+        return;
+    }
+
+    try
+    {
+        m_thread = std::thread(&ConfigWatcher::run, this);
+    }
+    catch (...)
+    {
+        ::close(m_inotify);
+        ::close(m_wake);
+        m_inotify = m_wake = -1;
+    }
+}
+
+ConfigWatcher::~ConfigWatcher() noexcept
+{
+    if (!m_thread.joinable())
+        return;
+
+    const std::uint64_t wake = 1;
+    static_cast<void>(::write(m_wake, &wake, sizeof(wake)));
+    m_thread.join();
+
+    ::close(m_inotify);
+    ::close(m_wake);
+}
+
+bool ConfigWatcher::is_watching() const noexcept
+{
+    return m_thread.joinable();
+}
+
+void ConfigWatcher::run() noexcept
+{
+    pollfd descriptors[2] = {{m_inotify, POLLIN, 0}, {m_wake, POLLIN, 0}};
+    alignas(inotify_event) char buffer[4096];
+
+    while (true)
+    {
+        if (::poll(descriptors, 2, -1) == -1)
+            continue;
+
+        if (descriptors[1].revents != 0)
+            return;
+
+        bool changed = false;
+        ssize_t size;
+        while ((size = ::read(m_inotify, buffer, sizeof(buffer))) > 0)
+        {
+            for (ssize_t offset = 0; offset < size;)
+            {
+                inotify_event event;
+                std::memcpy(&event, buffer + offset, sizeof(event));
+                const char* name = buffer + offset + sizeof(inotify_event);
+                if (event.len > 0 && m_file_name == name)
+                    changed = true;
+
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + event.len);
+            }
+        }
+
+        if (changed)
+            m_registry.load(m_path);
+    }
+}
+} // isc
@@ -0,0 +1,164 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "Coroutine.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace isc
+{
+namespace
+{
+thread_local Executor* t_executor = nullptr;
+
+/**
+ * Resumes a coroutine through an executor, or right away on the calling thread if there is none.
+ */
+void resume(std::coroutine_handle<> coroutine, Executor* executor) noexcept
+{
+    if (executor != nullptr)
+        executor->post(coroutine);
+    else
+        coroutine.resume();
+}
+}
+
+Executor::Scope::Scope(Executor& executor) noexcept
+    : m_previous(std::exchange(t_executor, &executor))
+{}
+
+Executor::Scope::~Scope() noexcept
+{
+    t_executor = m_previous;
+}
+
+Executor* Executor::current() noexcept
+{
+    return t_executor;
+}
+
+TraceContext::Frame::Frame(TraceContext& context, const std::string_view frame) noexcept
+    : m_context(context),
+      m_previous(context.m_frames)
+{
+    m_context.m_frames.append(frame);
+}
+
+TraceContext::Frame::~Frame() noexcept
+{
+    // The previous copy still shares the block, so restoring it drops the frame without freeing anything.
+    m_context.m_frames = std::move(m_previous);
+}
+
+TraceContext::Frame TraceContext::enter(const std::string_view frame) noexcept
+{
+    return Frame(*this, frame);
+}
+
+void TraceContext::apply(Message& message) const noexcept
+{
+    thread_local std::vector<std::string_view> t_frames;
+
+    // Chains only iterate forwards, so the frames are gathered first to add them innermost first.
+    try
+    {
+        t_frames.assign(m_frames.begin(), m_frames.end());
+    }
+    catch (...)
+    {
+        t_frames.clear();
+    }
+
+    for (auto frame = t_frames.rbegin(); frame != t_frames.rend(); ++frame)
+        message.add_trace(*frame);
+}
+
+const util::TraceChain& TraceContext::frames() const noexcept
+{
+    return m_frames;
+}
+
+LogAwaitable::LogAwaitable(const AsyncLogger& logger, const Message& message) noexcept
+    : m_logger(logger),
+      m_filtered(!logger.should_log(message.severity()))
+{
+    if (!m_filtered)
+        m_record = Record(message);
+}
+
+bool LogAwaitable::await_ready() noexcept
+{
+    return m_filtered || m_logger.try_log(m_record);
+}
+
+bool LogAwaitable::await_suspend(const std::coroutine_handle<> coroutine) noexcept
+{
+    m_coroutine = coroutine;
+    m_executor  = Executor::current();
+    m_waiter    = {.complete = &LogAwaitable::complete, .context = this, .record = &m_record};
+    return m_logger.wait(m_waiter);
+}
+
+void LogAwaitable::await_resume() const noexcept
+{}
+
+void LogAwaitable::complete(AsyncLogger::Waiter& waiter) noexcept
+{
+    const auto* awaitable = static_cast<LogAwaitable*>(waiter.context);
+    resume(awaitable->m_coroutine, awaitable->m_executor);
+}
+
+FlushAwaitable::FlushAwaitable(AsyncLogger& logger) noexcept
+    : m_logger(logger)
+{}
+
+bool FlushAwaitable::await_ready() noexcept
+{
+    if (!m_logger.m_worker.joinable())
+    {
+        m_logger.flush();
+        return true;
+    }
+
+    m_waiter.target = m_logger.m_queue.push_count();
+    return m_logger.m_processed.load(std::memory_order_acquire) >= m_waiter.target;
+}
+
+bool FlushAwaitable::await_suspend(const std::coroutine_handle<> coroutine) noexcept
+{
+    m_coroutine       = coroutine;
+    m_executor        = Executor::current();
+    m_waiter.complete = &FlushAwaitable::complete;
+    m_waiter.context  = this;
+    return m_logger.wait(m_waiter);
+}
+
+void FlushAwaitable::await_resume() const noexcept
+{}
+
+void FlushAwaitable::complete(AsyncLogger::Waiter& waiter) noexcept
+{
+    const auto* awaitable = static_cast<FlushAwaitable*>(waiter.context);
+    resume(awaitable->m_coroutine, awaitable->m_executor);
+}
+
+LogAwaitable co_log(const AsyncLogger& logger, const Message& message) noexcept
+{
+    return LogAwaitable(logger, message);
+}
+
+LogAwaitable co_log(const AsyncLogger& logger, Message message, const TraceContext& trace) noexcept
+{
+    if (logger.should_log(message.severity()))
+        trace.apply(message);
+
+    return LogAwaitable(logger, message);
+}
+
+FlushAwaitable co_flush(AsyncLogger& logger) noexcept
+{
+    return FlushAwaitable(logger);
+}
+} // isc
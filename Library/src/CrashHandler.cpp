@@ -0,0 +1,310 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "CrashHandler.hpp"
+
+#include "SignalWriter.hpp"
+
+#include <atomic>
+#include <iterator>
+
+#if !defined(_WIN32)
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string_view>
+
+#include <pthread.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if __has_include(<execinfo.h>)
+#include <execinfo.h>
+#define ISCLOGS_HAS_BACKTRACE 1
+#endif
+#endif
+
+namespace isc
+{
+namespace
+{
+std::atomic<const Logger*> s_loggers[CrashHandler::max_loggers];
+
+#if !defined(_WIN32)
+constexpr int s_signals[]           = {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT};
+constexpr std::size_t s_frame_limit = 256;
+
+std::mutex s_install_mutex;
+struct sigaction s_previous[std::size(s_signals)];
+bool s_installed = false;
+
+// Set by install before the handler is installed, later installs only ever grow the emergency buffer.
+std::atomic<int> s_fd                 = -1;
+char* s_emergency                     = nullptr;
+std::size_t s_emergency_size          = 0;
+std::atomic<std::size_t> s_max_frames = 0;
+
+// The first thread to crash owns the report, any other thread that crashes meanwhile waits for the process to die.
+std::atomic<bool> s_crashing = false;
+std::atomic<bool> s_owned    = false;
+pthread_t s_owner;
+
+struct AlternateStack
+{
+    ~AlternateStack()
+    {
+        if (memory == nullptr)
+            return;
+
+        stack_t disable{};
+        disable.ss_flags = SS_DISABLE;
+        ::sigaltstack(&disable, nullptr);
+        ::munmap(memory, size);
+    }
+
+    void* memory     = nullptr;
+    std::size_t size = 0;
+};
+
+thread_local AlternateStack t_stack;
+std::atomic<std::size_t> s_stack_size = 64 * 1024;
+
+std::string_view signal_name(const int signal) noexcept
+{
+    switch (signal)
+    {
+    case SIGSEGV:
+        return "SIGSEGV";
+    case SIGBUS:
+        return "SIGBUS";
+    case SIGFPE:
+        return "SIGFPE";
+    case SIGILL:
+        return "SIGILL";
+    case SIGABRT:
+        return "SIGABRT";
+    default:
+        return "signal";
+    }
+}
+
+void restore(const int signal) noexcept
+{
+    for (std::size_t i = 0; i < std::size(s_signals); ++i)
+    {
+        if (s_signals[i] != signal)
+            continue;
+
+        // A fault that is ignored would be retried forever, so it is given the default action instead.
+        if (s_previous[i].sa_handler == SIG_IGN)
+        {
+            struct sigaction fallback{};
+            fallback.sa_handler = SIG_DFL;
+            ::sigemptyset(&fallback.sa_mask);
+            ::sigaction(signal, &fallback, nullptr);
+        }
+        else
+            ::sigaction(signal, &s_previous[i], nullptr);
+    }
+}
+
+void write_report(const int signal, const siginfo_t* info) noexcept
+{
+    const int fd = s_fd.load(std::memory_order_acquire);
+    util::SignalWriter writer(fd, {s_emergency, s_emergency_size});
+
+    writer.write("[Fatal]: Crash - Received ");
+    writer.write(signal_name(signal));
+    if (signal != SIGABRT && info != nullptr)
+    {
+        writer.write(" at address ");
+        writer.write_hex(reinterpret_cast<std::uintptr_t>(info->si_addr));
+    }
+    writer.write(", writing pending records\n");
+
+    CrashHandler::dump_pending(writer);
+
+#if defined(ISCLOGS_HAS_BACKTRACE)
+    const std::size_t max_frames = std::min(s_max_frames.load(std::memory_order_relaxed), s_frame_limit);
+    if (max_frames > 0)
+    {
+        void* frames[s_frame_limit];
+        const int count = ::backtrace(frames, static_cast<int>(max_frames));
+
+        writer.write("Backtrace:\n");
+        writer.flush();
+        // Symbolises from the binary's own symbol table straight into the file descriptor, without allocating.
+        ::backtrace_symbols_fd(frames, count, fd);
+    }
+#endif
+}
+
+void handle_crash(const int signal, siginfo_t* info, void*) noexcept
+{
+    const int saved_errno = errno;
+
+    bool expected = false;
+    if (s_crashing.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+    {
+        s_owner = ::pthread_self();
+        s_owned.store(true, std::memory_order_release);
+
+        write_report(signal, info);
+    }
+    else
+    {
+        while (!s_owned.load(std::memory_order_acquire))
+        {}
+
+        // Another thread is writing the report and will take the process down once it is done.
+        if (!::pthread_equal(s_owner, ::pthread_self()))
+        {
+            while (true)
+                ::pause();
+        }
+    }
+
+    // The signal is raised again with the previous action, once this handler returns and unblocks it.
+    // Faults that were not raised happen again when the faulting instruction is retried, with the same result.
+    restore(signal);
+    ::raise(signal);
+    errno = saved_errno;
+}
+#endif
+} // namespace
+
+bool CrashHandler::watch(const Logger& logger) noexcept
+{
+    for (std::atomic<const Logger*>& slot : s_loggers)
+    {
+        const Logger* expected = nullptr;
+        if (slot.compare_exchange_strong(expected, &logger, std::memory_order_acq_rel))
+            return true;
+    }
+
+    return false;
+}
+
+void CrashHandler::unwatch(const Logger& logger) noexcept
+{
+    for (std::atomic<const Logger*>& slot : s_loggers)
+    {
+        const Logger* expected = &logger;
+        if (slot.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel))
+            return;
+    }
+}
+
+void CrashHandler::dump_pending(util::SignalWriter& writer) noexcept
+{
+    for (const std::atomic<const Logger*>& slot : s_loggers)
+    {
+        const Logger* logger = slot.load(std::memory_order_acquire);
+        if (logger != nullptr)
+            logger->dump_pending_internal(writer);
+    }
+}
+
+#if !defined(_WIN32)
+bool CrashHandler::install(const int fd) noexcept
+{
+    return install(fd, Options());
+}
+
+bool CrashHandler::install(const int fd, const Options& options) noexcept
+{
+    std::lock_guard lock(s_install_mutex);
+
+    if (options.emergency_size > s_emergency_size)
+    {
+        void* memory = ::mmap(nullptr, options.emergency_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED)
+            return false;
+
+        // Touching every page now means the handler never faults memory in, even if the system is out of it by then.
+        std::memset(memory, 0, options.emergency_size);
+
+        // A larger buffer replaces the old one, which is kept mapped in case a crash is already using it.
+        s_emergency      = static_cast<char*>(memory);
+        s_emergency_size = options.emergency_size;
+    }
+
+    s_stack_size.store(options.alternate_stack_size, std::memory_order_relaxed);
+    if (!protect_thread())
+        return false;
+
+#if defined(ISCLOGS_HAS_BACKTRACE)
+    // The first backtrace loads the unwinder, which allocates, so it has to happen before any crash does.
+    void* frame = nullptr;
+    ::backtrace(&frame, 1);
+#endif
+
+    s_max_frames.store(options.max_frames, std::memory_order_relaxed);
+    s_fd.store(fd, std::memory_order_release);
+
+    if (s_installed)
+        return true;
+
+    struct sigaction action{};
+    action.sa_sigaction = handle_crash;
+    action.sa_flags     = SA_SIGINFO | SA_ONSTACK;
+    ::sigemptyset(&action.sa_mask);
+
+    for (std::size_t i = 0; i < std::size(s_signals); ++i)
+    {
+        if (::sigaction(s_signals[i], &action, &s_previous[i]) != 0)
+        {
+            while (i-- > 0)
+                ::sigaction(s_signals[i], &s_previous[i], nullptr);
+
+            return false;
+        }
+    }
+
+    s_installed = true;
+    return true;
+}
+
+bool CrashHandler::protect_thread() noexcept
+{
+    AlternateStack& stack = t_stack;
+    if (stack.memory != nullptr)
+        return true;
+
+    const std::size_t size = std::max<std::size_t>(s_stack_size.load(std::memory_order_relaxed), MINSIGSTKSZ);
+    void* memory           = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED)
+        return false;
+
+    stack_t alternate{};
+    alternate.ss_sp    = memory;
+    alternate.ss_size  = size;
+    alternate.ss_flags = 0;
+    if (::sigaltstack(&alternate, nullptr) != 0)
+    {
+        ::munmap(memory, size);
+        return false;
+    }
+
+    stack.memory = memory;
+    stack.size   = size;
+    return true;
+}
+
+void CrashHandler::uninstall() noexcept
+{
+    std::lock_guard lock(s_install_mutex);
+    if (!s_installed)
+        return;
+
+    for (std::size_t i = 0; i < std::size(s_signals); ++i)
+        ::sigaction(s_signals[i], &s_previous[i], nullptr);
+
+    s_installed = false;
+}
+#endif
+} // isc
@@ -0,0 +1,222 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "Encoder.hpp"
+
+#include "Escape.hpp"
+#include "TimestampFormatter.hpp"
+
+#include <charconv>
+#include <type_traits>
+
+namespace isc
+{
+namespace
+{
+const util::TimestampFormatter s_timestamps;
+
+template <typename T>
+void append_number(const T number, std::string& out)
+{
+    char buffer[32];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), number);
+    out.append(buffer, result.ptr);
+}
+
+util::Fields::View fields_of(const Message& message) noexcept
+{
+    return message.fields().view();
+}
+
+util::Fields::View fields_of(const Record& record) noexcept
+{
+    return record.fields();
+}
+
+// Deferred descriptions of records are formatted into a buffer reused by the thread before they are escaped.
+std::string_view description_of(const Message& message)
+{
+    return message.description();
+}
+
+std::string_view description_of(const Record& record)
+{
+    if (!record.deferred())
+        return record.description();
+
+    thread_local std::string t_description;
+    t_description.clear();
+    record.format_description_to(t_description);
+    return t_description;
+}
+
+template <typename Function>
+void for_each_frame(const Message& message, Function&& function)
+{
+    for (const std::string_view frame : message.get_trace())
+        function(frame);
+}
+
+template <typename Function>
+void for_each_frame(const Record& record, Function&& function)
+{
+    for (std::size_t i = 0; i < record.trace_size(); ++i)
+        function(record.trace(i));
+}
+
+template <typename T>
+void encode_json(const T& source, std::string& out)
+{
+    out += "{\"time\":\"";
+    s_timestamps.append(source.timestamp(), out);
+    out += '"';
+    if constexpr (std::is_same_v<T, Record>)
+    {
+        out += ",\"thread\":";
+        append_number(source.thread_id(), out);
+    }
+
+    out += ",\"severity\":\"";
+    out += Message::severity_name(source.severity());
+    out += "\",\"code\":";
+    append_number(source.code(), out);
+    out += ",\"name\":";
+    util::append_json_string(source.name(), out);
+    if (source.has_description())
+    {
+        out += ",\"description\":";
+        util::append_json_string(description_of(source), out);
+    }
+
+    out += ",\"file\":";
+    util::append_json_string(source.location().file_name(), out);
+    out += ",\"line\":";
+    append_number(source.location().line(), out);
+    out += ",\"function\":";
+    util::append_json_string(source.location().function_name(), out);
+
+    const util::Fields::View fields = fields_of(source);
+    if (!fields.empty())
+    {
+        char separator = '{';
+        out += ",\"fields\":";
+        for (const util::Field& field : fields)
+        {
+            out += separator;
+            util::append_json_string(field.key, out);
+            out += ':';
+            field.append_json(out);
+            separator = ',';
+        }
+        out += '}';
+    }
+
+    bool traced = false;
+    for_each_frame(source, [&](const std::string_view frame) {
+        out += traced ? "," : ",\"trace\":[";
+        util::append_json_string(frame, out);
+        traced = true;
+    });
+    if (traced)
+        out += ']';
+
+    out += '}';
+}
+
+template <typename T>
+void encode_logfmt(const T& source, std::string& out)
+{
+    out += "time=";
+    s_timestamps.append(source.timestamp(), out);
+    if constexpr (std::is_same_v<T, Record>)
+    {
+        out += " thread=";
+        append_number(source.thread_id(), out);
+    }
+
+    out += " severity=";
+    out += Message::severity_name(source.severity());
+    out += " code=";
+    append_number(source.code(), out);
+    out += " name=";
+    util::append_logfmt_value(source.name(), out);
+    if (source.has_description())
+    {
+        out += " description=";
+        util::append_logfmt_value(description_of(source), out);
+    }
+
+    out += " file=";
+    util::append_logfmt_value(source.location().file_name(), out);
+    out += " line=";
+    append_number(source.location().line(), out);
+    out += " function=";
+    util::append_logfmt_value(source.location().function_name(), out);
+
+    util::Fields::format_to(fields_of(source), out);
+
+    // Frames are joined into a single value, logfmt has no lists.
+    thread_local std::string t_trace;
+    t_trace.clear();
+    for_each_frame(source, [&](const std::string_view frame) {
+        if (!t_trace.empty())
+            t_trace += " <- ";
+        t_trace += frame;
+    });
+    if (!t_trace.empty())
+    {
+        out += " trace=";
+        util::append_logfmt_value(t_trace, out);
+    }
+}
+
+template <typename T>
+void encode_as(const Encoding encoding, const T& source, std::string& out)
+{
+    switch (encoding)
+    {
+    case Encoding::Json:
+        encode_json(source, out);
+        return;
+    case Encoding::Logfmt:
+        encode_logfmt(source, out);
+        return;
+    case Encoding::Text:
+        break;
+    }
+
+    source.format_to(out);
+}
+} // namespace
+
+void Encoder::encode(const Encoding encoding, const Message& message, std::string& out)
+{
+    encode_as(encoding, message, out);
+}
+
+void Encoder::encode(const Encoding encoding, const Record& record, std::string& out)
+{
+    encode_as(encoding, record, out);
+}
+
+void Encoder::json(const Message& message, std::string& out)
+{
+    encode_json(message, out);
+}
+
+void Encoder::json(const Record& record, std::string& out)
+{
+    encode_json(record, out);
+}
+
+void Encoder::logfmt(const Message& message, std::string& out)
+{
+    encode_logfmt(message, out);
+}
+
+void Encoder::logfmt(const Record& record, std::string& out)
+{
+    encode_logfmt(record, out);
+}
+} // isc
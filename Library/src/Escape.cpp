@@ -0,0 +1,150 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "Escape.hpp"
+
+#include <bit>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ISCLOGS_ESCAPE_SSE2 1
+#endif
+
+namespace isc::util
+{
+namespace
+{
+// Characters that are escaped inside quotes, in both JSON and logfmt.
+constexpr bool needs_escape(const char character) noexcept
+{
+    return character == '"' || character == '\\' || static_cast<unsigned char>(character) < 0x20;
+}
+
+// Characters that force a logfmt value to be quoted.
+constexpr bool needs_quotes(const char character) noexcept
+{
+    return needs_escape(character) || character == ' ' || character == '=';
+}
+
+/**
+ * Returns the position of the first special character at or after from, or the size of the string if there is none.
+ * @tparam Quoting Whether spaces and equal signs are special too, as they are when deciding whether to quote a logfmt value.
+ */
+template <bool Quoting>
+std::size_t find_special(const std::string_view string, std::size_t from) noexcept
+{
+    const char* data       = string.data();
+    const std::size_t size = string.size();
+
+#if defined(ISCLOGS_ESCAPE_SSE2)
+    const __m128i quote     = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i control   = _mm_set1_epi8(0x1F);
+    const __m128i space     = _mm_set1_epi8(' ');
+    const __m128i equals    = _mm_set1_epi8('=');
+
+    for (; from + 16 <= size; from += 16)
+    {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + from));
+
+        // A byte is a control character if it is unchanged by an unsigned minimum with 0x1F.
+        __m128i special = _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash));
+        special         = _mm_or_si128(special, _mm_cmpeq_epi8(_mm_min_epu8(chunk, control), chunk));
+        if constexpr (Quoting)
+            special = _mm_or_si128(special, _mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, equals)));
+
+        const auto mask = static_cast<unsigned int>(_mm_movemask_epi8(special));
+        if (mask != 0)
+            return from + static_cast<std::size_t>(std::countr_zero(mask));
+    }
+#endif
+
+    for (; from < size; ++from)
+    {
+        if (Quoting ? needs_quotes(data[from]) : needs_escape(data[from]))
+            return from;
+    }
+
+    return size;
+}
+
+void append_escape(const char character, std::string& out)
+{
+    switch (character)
+    {
+    case '"':
+        out += "\\\"";
+        return;
+    case '\\':
+        out += "\\\\";
+        return;
+    case '\n':
+        out += "\\n";
+        return;
+    case '\r':
+        out += "\\r";
+        return;
+    case '\t':
+        out += "\\t";
+        return;
+    case '\b':
+        out += "\\b";
+        return;
+    case '\f':
+        out += "\\f";
+        return;
+    default:
+        break;
+    }
+
+    constexpr std::string_view digits = "0123456789abcdef";
+    const auto byte                   = static_cast<unsigned char>(character);
+    const char escape[]               = {'\\', 'u', '0', '0', digits[byte >> 4], digits[byte & 0xF]};
+    out.append(escape, sizeof(escape));
+}
+
+// Appends a string between quotes, escaping what has to be.
+void append_quoted(const std::string_view string, std::string& out)
+{
+    out.reserve(out.size() + string.size() + 2);
+    out += '"';
+
+    std::size_t start = 0;
+    while (true)
+    {
+        const std::size_t position = find_special<false>(string, start);
+        out.append(string.data() + start, position - start);
+        if (position == string.size())
+            break;
+
+        append_escape(string[position], out);
+        start = position + 1;
+    }
+
+    out += '"';
+}
+} // namespace
+
+void append_json_string(const std::string_view string, std::string& out)
+{
+    append_quoted(string, out);
+}
+
+void append_logfmt_value(const std::string_view string, std::string& out)
+{
+    if (!string.empty() && find_special<true>(string, 0) == string.size())
+    {
+        out += string;
+        return;
+    }
+
+    append_quoted(string, out);
+}
+
+std::size_t find_json_escape(const std::string_view string, const std::size_t from) noexcept
+{
+    return find_special<false>(string, from);
+}
+} // isc::util
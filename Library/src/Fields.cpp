@@ -0,0 +1,365 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "Fields.hpp"
+
+#include "Escape.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+namespace isc::util
+{
+namespace
+{
+// Decodes the field at offset, returning the offset of the next one, or 0 if the field is cut short.
+std::size_t decode(const std::span<const std::byte> encoded, std::size_t offset, Field& field) noexcept
+{
+    const auto read = [&](void* out, const std::size_t size) {
+        if (encoded.size() - offset < size)
+            return false;
+
+        std::memcpy(out, encoded.data() + offset, size);
+        offset += size;
+        return true;
+    };
+
+    std::uint8_t key_size = 0;
+    if (!read(&key_size, sizeof(key_size)) || encoded.size() - offset < key_size)
+        return 0;
+
+    field.key = {reinterpret_cast<const char*>(encoded.data() + offset), key_size};
+    offset += key_size;
+
+    if (!read(&field.type, sizeof(field.type)))
+        return 0;
+
+    switch (field.type)
+    {
+    case Field::Type::Bool:
+    {
+        std::uint8_t byte = 0;
+        if (!read(&byte, sizeof(byte)))
+            return 0;
+
+        field.boolean = byte != 0;
+        return offset;
+    }
+    case Field::Type::Int:
+        return read(&field.integer, sizeof(field.integer)) ? offset : 0;
+    case Field::Type::UInt:
+        return read(&field.unsigned_integer, sizeof(field.unsigned_integer)) ? offset : 0;
+    case Field::Type::Double:
+        return read(&field.number, sizeof(field.number)) ? offset : 0;
+    case Field::Type::String:
+    {
+        std::uint32_t size = 0;
+        if (!read(&size, sizeof(size)) || encoded.size() - offset < size)
+            return 0;
+
+        field.string = {reinterpret_cast<const char*>(encoded.data() + offset), size};
+        return offset + size;
+    }
+    }
+
+    return 0;
+}
+
+template <typename T>
+void append_number(const T number, std::string& out)
+{
+    char buffer[32];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), number);
+    out.append(buffer, result.ptr);
+}
+
+// Appends every value but strings, which are quoted differently by JSON and logfmt.
+void append_scalar(const Field& field, std::string& out)
+{
+    switch (field.type)
+    {
+    case Field::Type::Bool:
+        out += field.boolean ? "true" : "false";
+        break;
+    case Field::Type::Int:
+        append_number(field.integer, out);
+        break;
+    case Field::Type::UInt:
+        append_number(field.unsigned_integer, out);
+        break;
+    case Field::Type::Double:
+        append_number(field.number, out);
+        break;
+    case Field::Type::String:
+        break;
+    }
+}
+} // namespace
+
+void Field::append_json(std::string& out) const
+{
+    if (type == Type::String)
+        append_json_string(string, out);
+    else if (type == Type::Double && !std::isfinite(number))
+        out += "null";
+    else
+        append_scalar(*this, out);
+}
+
+void Field::append_logfmt(std::string& out) const
+{
+    if (type == Type::String)
+        append_logfmt_value(string, out);
+    else
+        append_scalar(*this, out);
+}
+
+Fields::Iterator::Iterator(const std::span<const std::byte> encoded) noexcept
+    : m_encoded(encoded)
+{
+    ++*this;
+}
+
+const Field& Fields::Iterator::operator*() const noexcept
+{
+    return m_field;
+}
+
+Fields::Iterator& Fields::Iterator::operator++() noexcept
+{
+    // Fields that are cut short end the range.
+    m_offset = m_next;
+    if (m_offset < m_encoded.size())
+    {
+        m_next = decode(m_encoded, m_offset, m_field);
+        if (m_next == 0)
+            m_offset = m_next = m_encoded.size();
+    }
+
+    return *this;
+}
+
+Fields::Iterator Fields::Iterator::operator++(int) noexcept
+{
+    const Iterator previous = *this;
+    ++*this;
+    return previous;
+}
+
+bool Fields::Iterator::operator==(const Iterator& other) const noexcept
+{
+    return m_encoded.data() == other.m_encoded.data() && m_offset == other.m_offset;
+}
+
+Fields::View::View(const std::span<const std::byte> encoded) noexcept
+    : m_encoded(encoded)
+{}
+
+bool Fields::View::empty() const noexcept
+{
+    return m_encoded.empty();
+}
+
+Fields::Iterator Fields::View::begin() const noexcept
+{
+    return Iterator(m_encoded);
+}
+
+Fields::Iterator Fields::View::end() const noexcept
+{
+    Iterator end;
+    end.m_encoded = m_encoded;
+    end.m_offset  = end.m_next = m_encoded.size();
+    return end;
+}
+
+Fields::~Fields() noexcept
+{
+    release();
+}
+
+Fields::Fields(const Fields& fields) noexcept
+{
+    copy_from(fields.encoded());
+}
+
+Fields& Fields::operator=(const Fields& fields) noexcept
+{
+    if (&fields != this)
+    {
+        m_size = 0;
+        copy_from(fields.encoded());
+    }
+
+    return *this;
+}
+
+Fields::Fields(Fields&& fields) noexcept
+{
+    *this = std::move(fields);
+}
+
+Fields& Fields::operator=(Fields&& fields) noexcept
+{
+    if (&fields == this)
+        return *this;
+
+    if (fields.m_heap == nullptr)
+    {
+        m_size = 0;
+        copy_from(fields.encoded());
+        return *this;
+    }
+
+    release();
+    m_heap     = fields.m_heap;
+    m_size     = fields.m_size;
+    m_capacity = fields.m_capacity;
+
+    fields.m_heap     = nullptr;
+    fields.m_size     = 0;
+    fields.m_capacity = inline_capacity;
+    return *this;
+}
+
+Fields Fields::from_encoded(const std::span<const std::byte> encoded) noexcept
+{
+    Fields fields;
+    fields.copy_from(encoded);
+    return fields;
+}
+
+bool Fields::empty() const noexcept
+{
+    return m_size == 0;
+}
+
+std::span<const std::byte> Fields::encoded() const noexcept
+{
+    return {m_heap != nullptr ? m_heap : m_inline, m_size};
+}
+
+Fields::View Fields::view() const noexcept
+{
+    return View(encoded());
+}
+
+Fields::Iterator Fields::begin() const noexcept
+{
+    return view().begin();
+}
+
+Fields::Iterator Fields::end() const noexcept
+{
+    return view().end();
+}
+
+void Fields::format_to(const View fields, std::string& out)
+{
+    for (const Field& field : fields)
+    {
+        out += ' ';
+        out += field.key;
+        out += '=';
+        field.append_logfmt(out);
+    }
+}
+
+void Fields::append(std::string_view key, const Field::Type type, const void* value, std::size_t size) noexcept
+{
+    key = key.substr(0, max_key_size);
+    if (size > std::numeric_limits<std::uint32_t>::max())
+        return;
+
+    const bool string         = type == Field::Type::String;
+    const std::size_t encoded = 1 + key.size() + 1 + (string ? sizeof(std::uint32_t) : 0) + size;
+    if (!reserve(m_size + encoded))
+        return;
+
+    std::byte* out   = data() + m_size;
+    const auto write = [&](const void* bytes, const std::size_t count) {
+        if (count > 0)
+            std::memcpy(out, bytes, count);
+        out += count;
+    };
+
+    const auto key_size = static_cast<std::uint8_t>(key.size());
+    write(&key_size, sizeof(key_size));
+    write(key.data(), key.size());
+    write(&type, sizeof(type));
+    if (string)
+    {
+        const auto string_size = static_cast<std::uint32_t>(size);
+        write(&string_size, sizeof(string_size));
+    }
+    write(value, size);
+
+    m_size += static_cast<std::uint32_t>(encoded);
+}
+
+bool Fields::reserve(const std::size_t size) noexcept
+{
+    if (size <= m_capacity)
+        return true;
+
+    if (size > std::numeric_limits<std::uint32_t>::max())
+        return false;
+
+    const std::size_t capacity = std::max<std::size_t>(size, std::min<std::size_t>(m_capacity * 2ull, std::numeric_limits<std::uint32_t>::max()));
+    auto* heap                 = static_cast<std::byte*>(std::malloc(capacity));
+    if (heap == nullptr)
+        return false;
+
+    if (m_size > 0)
+        std::memcpy(heap, data(), m_size);
+
+    std::free(m_heap);
+    m_heap     = heap;
+    m_capacity = static_cast<std::uint32_t>(capacity);
+    return true;
+}
+
+void Fields::copy_from(const std::span<const std::byte> encoded) noexcept
+{
+    if (reserve(encoded.size()))
+    {
+        if (!encoded.empty())
+            std::memcpy(data(), encoded.data(), encoded.size());
+        m_size = static_cast<std::uint32_t>(encoded.size());
+        return;
+    }
+
+    // Keep the fields that fit in the buffer that is already there, the rest are dropped.
+    std::size_t size = 0;
+    Field field{};
+    for (std::size_t next = 0; size < encoded.size(); size = next)
+    {
+        next = decode(encoded, size, field);
+        if (next == 0 || next > m_capacity)
+            break;
+    }
+
+    if (size > 0)
+        std::memcpy(data(), encoded.data(), size);
+    m_size = static_cast<std::uint32_t>(size);
+}
+
+void Fields::release() noexcept
+{
+    std::free(m_heap);
+    m_heap     = nullptr;
+    m_size     = 0;
+    m_capacity = inline_capacity;
+}
+
+std::byte* Fields::data() noexcept
+{
+    return m_heap != nullptr ? m_heap : m_inline;
+}
+} // isc::util
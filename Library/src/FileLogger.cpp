@@ -0,0 +1,387 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "FileLogger.hpp"
+
+#include "CrashHandler.hpp"
+#include "Metrics.hpp"
+#include "SignalWriter.hpp"
+#include "TimestampFormatter.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstdio>
+#include <limits>
+
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace isc
+{
+namespace
+{
+thread_local std::string t_line;
+
+const util::TimestampFormatter s_timestamps;
+
+// Starts a new line, with the time the message was constructed at if text lines are timestamped.
+void begin_line(const FileLogger::Options& options, const std::uint64_t timestamp)
+{
+    t_line.clear();
+    if (options.timestamps && options.encoding == Encoding::Text)
+    {
+        s_timestamps.append(timestamp, t_line);
+        t_line += ' ';
+    }
+}
+
+#ifdef IOV_MAX
+constexpr std::size_t s_max_iovecs = IOV_MAX;
+#else
+constexpr std::size_t s_max_iovecs = 16;
+#endif
+
+#ifdef PATH_MAX
+constexpr std::size_t s_max_name = PATH_MAX;
+#else
+constexpr std::size_t s_max_name = 4096;
+#endif
+
+// Writes the name of the index-th rotated file into name, the path itself for 0, and returns whether it fit.
+bool rotated_name(const std::string& path, const std::size_t index, char (&name)[s_max_name]) noexcept
+{
+    // Room for the dot, the index and the null terminator.
+    if (path.size() + 1 + std::numeric_limits<std::size_t>::digits10 + 2 > s_max_name)
+        return false;
+
+    char* end = std::copy(path.begin(), path.end(), name);
+    if (index > 0)
+    {
+        *end++ = '.';
+        end    = std::to_chars(end, name + s_max_name - 1, index).ptr;
+    }
+
+    *end = '\0';
+    return true;
+}
+}
+
+FileLogger::FileLogger(std::string path, const Message::Severity threshold) noexcept
+    : FileLogger(std::move(path), Options(), threshold)
+{}
+
+FileLogger::FileLogger(std::string path, const Options& options, const Message::Severity threshold) noexcept
+    : Logger(threshold),
+      m_path(std::move(path)),
+      m_options(options),
+      m_last_write(std::chrono::steady_clock::now())
+{
+    CrashHandler::watch(*this);
+
+    m_options.buffer_size  = std::max<std::size_t>(m_options.buffer_size, 1);
+    m_options.buffer_count = std::max<std::size_t>(m_options.buffer_count, 1);
+
+    try
+    {
+        for (Batch& batch : m_batches)
+        {
+            batch.buffers.resize(m_options.buffer_count);
+            batch.vectors.reserve(m_options.buffer_count);
+            for (std::string& buffer : batch.buffers)
+                buffer.reserve(m_options.buffer_size);
+        }
+    }
+    catch (...)
+    {
+        return;
+    }
+
+    open();
+}
+
+FileLogger::~FileLogger() noexcept
+{
+    CrashHandler::unwatch(*this);
+    flush();
+
+    if (m_file != -1)
+        ::close(m_file);
+}
+
+void FileLogger::flush() noexcept
+{
+    std::unique_lock lock(m_buffer_mutex);
+    hand_off(lock, true);
+}
+
+bool FileLogger::is_open() const noexcept
+{
+    std::lock_guard lock(m_io_mutex);
+    return m_file != -1;
+}
+
+void FileLogger::set_metrics(Metrics* metrics) noexcept
+{
+    m_metrics.store(metrics, std::memory_order_relaxed);
+}
+
+void FileLogger::log_message_internal(const Message& message) const noexcept
+{
+    try
+    {
+        begin_line(m_options, message.timestamp());
+        Encoder::encode(m_options.encoding, message, t_line);
+        t_line += '\n';
+    }
+    catch (...)
+    {
+        return;
+    }
+
+    append(t_line, message.is_failure());
+}
+
+void FileLogger::log_record_internal(const Record& record) const noexcept
+{
+    try
+    {
+        begin_line(m_options, record.timestamp());
+        Encoder::encode(m_options.encoding, record, t_line);
+        t_line += '\n';
+    }
+    catch (...)
+    {
+        return;
+    }
+
+    append(t_line, record.is_failure());
+}
+
+void FileLogger::log_shared_message_internal(const Message& message, const RenderCache& cache) const noexcept
+{
+    // The shared text is only ever formatted as Text.
+    if (m_options.encoding != Encoding::Text)
+    {
+        log_message_internal(message);
+        return;
+    }
+
+    try
+    {
+        begin_line(m_options, message.timestamp());
+        t_line += cache.text();
+        t_line += '\n';
+    }
+    catch (...)
+    {
+        return;
+    }
+
+    append(t_line, message.is_failure());
+}
+
+void FileLogger::log_shared_record_internal(const Record& record, const RenderCache& cache) const noexcept
+{
+    if (m_options.encoding != Encoding::Text)
+    {
+        log_record_internal(record);
+        return;
+    }
+
+    try
+    {
+        begin_line(m_options, record.timestamp());
+        t_line += cache.text();
+        t_line += '\n';
+    }
+    catch (...)
+    {
+        return;
+    }
+
+    append(t_line, record.is_failure());
+}
+
+void FileLogger::dump_pending_internal(util::SignalWriter&) const noexcept
+{
+    // Lines that are already formatted belong in the file rather than in the crash report.
+    // If the crashed thread holds either lock, the lines are lost rather than risking a deadlock.
+    if (!m_buffer_mutex.try_lock())
+        return;
+
+    if (m_io_mutex.try_lock())
+    {
+        Batch& batch = m_batches[m_front];
+        for (std::size_t i = 0; m_file != -1 && i < batch.buffers.size() && i <= batch.current; ++i)
+        {
+            std::string& buffer = batch.buffers[i];
+            util::SignalWriter::write_all(m_file, buffer.data(), buffer.size());
+            buffer.clear();
+        }
+
+        batch.current = 0;
+        m_io_mutex.unlock();
+    }
+
+    m_buffer_mutex.unlock();
+}
+
+void FileLogger::append(const std::string& line, const bool urgent) const noexcept
+{
+    std::unique_lock lock(m_buffer_mutex);
+
+    Batch& batch = m_batches[m_front];
+    if (batch.buffers.empty())
+        return;
+
+    try
+    {
+        batch.buffers[batch.current] += line;
+    }
+    catch (...)
+    {
+        return;
+    }
+
+    batch.urgent = batch.urgent || (urgent && m_options.fsync == FsyncPolicy::OnError);
+    if (batch.buffers[batch.current].size() >= m_options.buffer_size)
+        ++batch.current;
+
+    const bool full    = batch.current == batch.buffers.size();
+    const bool overdue = m_options.flush_interval.count() > 0
+                         && std::chrono::steady_clock::now() - m_last_write >= m_options.flush_interval;
+
+    if (full || batch.urgent || overdue)
+        hand_off(lock, false);
+}
+
+void FileLogger::hand_off(std::unique_lock<std::mutex>& buffer_lock, const bool force) const noexcept
+{
+    // Waiting here only happens while the other batch is still being written.
+    std::unique_lock io_lock(m_io_mutex);
+
+    Batch& batch = m_batches[m_front];
+    const bool empty = batch.current == 0 && (batch.buffers.empty() || batch.buffers[0].empty());
+    if (empty && !force)
+        return;
+
+    m_front      = 1 - m_front;
+    m_last_write = std::chrono::steady_clock::now();
+    buffer_lock.unlock();
+
+    write_batch(batch);
+}
+
+void FileLogger::write_batch(Batch& batch) const noexcept
+{
+    std::size_t size = 0;
+    for (const std::string& buffer : batch.buffers)
+        size += buffer.size();
+
+    rotate_if_needed(size);
+
+    // Never grows past the capacity reserved up front, so this does not allocate.
+    std::vector<iovec>& vectors = batch.vectors;
+    vectors.clear();
+    for (std::string& buffer : batch.buffers)
+    {
+        if (!buffer.empty())
+            vectors.push_back({buffer.data(), buffer.size()});
+    }
+
+    std::size_t first = 0;
+    while (m_file != -1 && first < vectors.size())
+    {
+        const std::size_t count = std::min(vectors.size() - first, s_max_iovecs);
+        const ssize_t written   = ::writev(m_file, vectors.data() + first, static_cast<int>(count));
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            break;
+        }
+
+        m_file_size += static_cast<std::uint64_t>(written);
+        if (Metrics* metrics = m_metrics.load(std::memory_order_relaxed); metrics != nullptr)
+            metrics->count_bytes(static_cast<std::uint64_t>(written));
+
+        // Skip over what was written, resuming part way through a buffer if the write was short.
+        auto remaining = static_cast<std::size_t>(written);
+        while (first < vectors.size() && remaining >= vectors[first].iov_len)
+            remaining -= vectors[first++].iov_len;
+
+        if (first < vectors.size())
+        {
+            vectors[first].iov_base = static_cast<char*>(vectors[first].iov_base) + remaining;
+            vectors[first].iov_len -= remaining;
+        }
+    }
+
+    const bool sync = m_options.fsync == FsyncPolicy::PerBatch || (m_options.fsync == FsyncPolicy::OnError && batch.urgent);
+    if (sync && m_file != -1)
+        ::fdatasync(m_file);
+
+    for (std::string& buffer : batch.buffers)
+        buffer.clear();
+
+    batch.current = 0;
+    batch.urgent  = false;
+}
+
+void FileLogger::rotate_if_needed(const std::size_t incoming) const noexcept
+{
+    if (m_file == -1 || m_file_size == 0)
+        return;
+
+    const bool too_big = m_options.max_file_size > 0 && m_file_size + incoming > m_options.max_file_size;
+    const bool too_old = m_options.rotation_interval.count() > 0
+                         && std::chrono::system_clock::now() - m_opened_at >= m_options.rotation_interval;
+
+    if (too_big || too_old)
+        rotate();
+}
+
+void FileLogger::rotate() const noexcept
+{
+    // The names are built on the stack, so rotating works without memory to spare.
+    char from[s_max_name];
+    char to[s_max_name];
+    if (!rotated_name(m_path, m_options.max_files, to))
+    {
+        // A path this long cannot be renamed anyway, so the file keeps growing rather than losing what is in it.
+        m_opened_at = std::chrono::system_clock::now();
+        return;
+    }
+
+    ::close(m_file);
+    m_file = -1;
+
+    if (m_options.max_files == 0)
+        ::unlink(m_path.c_str());
+
+    for (std::size_t i = m_options.max_files; i > 0; --i)
+    {
+        if (rotated_name(m_path, i - 1, from) && rotated_name(m_path, i, to))
+            std::rename(from, to);
+    }
+
+    open();
+}
+
+void FileLogger::open() const noexcept
+{
+    m_file = ::open(m_path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (m_file == -1)
+        return;
+
+    struct stat status{};
+    m_file_size = ::fstat(m_file, &status) == 0 ? static_cast<std::uint64_t>(status.st_size) : 0;
+    m_opened_at = std::chrono::system_clock::now();
+}
+} // isc
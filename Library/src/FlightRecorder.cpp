@@ -0,0 +1,176 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "FlightRecorder.hpp"
+
+#include "CrashHandler.hpp"
+#include "SignalWriter.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <utility>
+
+namespace isc
+{
+FlightRecorder::ThreadRing::ThreadRing(const std::size_t capacity)
+    : records(std::make_unique<Record[]>(std::bit_ceil(std::max<std::size_t>(capacity, 1)))),
+      mask(std::bit_ceil(std::max<std::size_t>(capacity, 1)) - 1)
+{}
+
+FlightRecorder::FlightRecorder(Logger& sink) noexcept
+    : FlightRecorder(sink, Options())
+{}
+
+FlightRecorder::FlightRecorder(Logger& sink, const Options& options) noexcept
+    : Logger(Message::Severity::Debug),
+      m_sink(sink),
+      m_options(options)
+{
+    CrashHandler::watch(*this);
+}
+
+FlightRecorder::~FlightRecorder() noexcept
+{
+    CrashHandler::unwatch(*this);
+}
+
+void FlightRecorder::dump() const noexcept
+{
+    dump_rings(true);
+}
+
+void FlightRecorder::log_message_internal(const Message& message) const noexcept
+{
+    if (m_sink.should_log(message.severity()))
+    {
+        if (message.is_failure())
+            dump_rings(m_options.dump_all_threads);
+
+        m_sink.log_message(message);
+        return;
+    }
+
+    ThreadRing* ring = local_ring();
+    if (ring == nullptr)
+        return;
+
+    // Captured straight into the ring, without spilling, so recording never allocates.
+    std::lock_guard lock(ring->mutex);
+    std::construct_at(&claim(*ring), message, false);
+}
+
+void FlightRecorder::log_record_internal(const Record& record) const noexcept
+{
+    if (m_sink.should_log(record.severity()))
+    {
+        if (record.is_failure())
+            dump_rings(m_options.dump_all_threads);
+
+        m_sink.log_record(record);
+        return;
+    }
+
+    ThreadRing* ring = local_ring();
+    if (ring == nullptr)
+        return;
+
+    std::lock_guard lock(ring->mutex);
+    claim(*ring) = record.inline_copy();
+}
+
+void FlightRecorder::dump_pending_internal(util::SignalWriter& writer) const noexcept
+{
+    // If the crashed thread holds a lock, the records behind it are lost rather than risking a deadlock.
+    if (!m_rings.mutex().try_lock())
+        return;
+
+    for (const std::shared_ptr<ThreadRing>& ring : m_rings.slots())
+    {
+        if (!ring->mutex.try_lock())
+            continue;
+
+        for (std::uint64_t i = ring->first; i != ring->next; ++i)
+            writer.write_record(ring->records[i & ring->mask]);
+
+        ring->mutex.unlock();
+    }
+
+    m_rings.mutex().unlock();
+}
+
+FlightRecorder::ThreadRing* FlightRecorder::local_ring() const noexcept
+{
+    // The rings of threads that have exited are taken over, so memory stays bounded by the threads alive at once.
+    return m_rings.local(
+        [this] { return std::make_shared<ThreadRing>(m_options.capacity); },
+        [](ThreadRing& ring) {
+            std::lock_guard lock(ring.mutex);
+            ring.first = ring.next;
+        }
+    );
+}
+
+Record& FlightRecorder::claim(ThreadRing& ring) noexcept
+{
+    Record& slot = ring.records[ring.next & ring.mask];
+    if (++ring.next - ring.first > ring.mask + 1)
+        ring.first = ring.next - (ring.mask + 1);
+
+    return slot;
+}
+
+void FlightRecorder::dump_rings(const bool all_threads) const noexcept
+{
+    thread_local std::vector<Record> t_batch;
+    thread_local std::vector<std::pair<std::uint64_t, std::uint32_t>> t_order;
+
+    t_batch.clear();
+    try
+    {
+        // Rings are never removed, only taken over, so they outlive the snapshot.
+        std::vector<ThreadRing*> rings;
+        if (all_threads)
+        {
+            std::lock_guard lock(m_rings.mutex());
+            for (const std::shared_ptr<ThreadRing>& ring : m_rings.slots())
+                rings.push_back(ring.get());
+        }
+        else if (ThreadRing* ring = local_ring(); ring != nullptr)
+            rings.push_back(ring);
+
+        // Records are copied out, so the rings are not held up while the sink logs them.
+        for (ThreadRing* ring : rings)
+        {
+            std::lock_guard lock(ring->mutex);
+            for (; ring->first != ring->next; ++ring->first)
+                t_batch.push_back(ring->records[ring->first & ring->mask]);
+        }
+    }
+    catch (...)
+    {
+        // Whatever was copied out before running out of memory is still dumped.
+    }
+
+    // Each ring is in order already, only the rings of several threads need merging.
+    // Records are large, so their timestamps are sorted instead, with ties kept in the order they were copied out in.
+    bool sorted = false;
+    if (all_threads)
+    {
+        try
+        {
+            t_order.clear();
+            for (std::size_t i = 0; i < t_batch.size(); ++i)
+                t_order.emplace_back(t_batch[i].timestamp(), static_cast<std::uint32_t>(i));
+            std::sort(t_order.begin(), t_order.end());
+            sorted = true;
+        }
+        catch (...)
+        {}
+    }
+
+    for (std::size_t i = 0; i < t_batch.size(); ++i)
+        m_sink.log_record_internal(t_batch[sorted ? t_order[i].second : i]);
+}
+} // isc
@@ -0,0 +1,572 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "FormatArgs.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <iterator>
+#include <thread>
+#include <utility>
+
+namespace isc::util
+{
+namespace
+{
+struct Argument
+{
+    FormatArgs::Type type = FormatArgs::Type::Int;
+
+    union
+    {
+        bool boolean;
+        char character;
+        std::int64_t integer;
+        std::uint64_t unsigned_integer;
+        float single;
+        double number;
+        const void* pointer;
+    };
+
+    std::string_view string;
+};
+
+// Returns the amount of arguments decoded, arguments that are cut short are dropped.
+std::size_t decode(const std::span<const std::byte> encoded, std::array<Argument, FormatArgs::max_arguments>& arguments) noexcept
+{
+    if (encoded.empty())
+        return 0;
+
+    const std::size_t count = std::min(static_cast<std::size_t>(encoded[0]), FormatArgs::max_arguments);
+    std::size_t offset      = 1;
+
+    const auto read = [&](void* out, const std::size_t size) {
+        if (encoded.size() - offset < size)
+            return false;
+
+        std::memcpy(out, encoded.data() + offset, size);
+        offset += size;
+        return true;
+    };
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Argument& argument = arguments[i];
+        if (!read(&argument.type, 1))
+            return i;
+
+        bool complete = false;
+        switch (argument.type)
+        {
+        case FormatArgs::Type::Bool:
+            complete = read(&argument.boolean, 1);
+            break;
+        case FormatArgs::Type::Char:
+            complete = read(&argument.character, 1);
+            break;
+        case FormatArgs::Type::Int:
+            complete = read(&argument.integer, sizeof(argument.integer));
+            break;
+        case FormatArgs::Type::UInt:
+            complete = read(&argument.unsigned_integer, sizeof(argument.unsigned_integer));
+            break;
+        case FormatArgs::Type::Float:
+            complete = read(&argument.single, sizeof(argument.single));
+            break;
+        case FormatArgs::Type::Double:
+            complete = read(&argument.number, sizeof(argument.number));
+            break;
+        case FormatArgs::Type::Pointer:
+        {
+            std::uint64_t address = 0;
+            complete              = read(&address, sizeof(address));
+            argument.pointer      = reinterpret_cast<const void*>(static_cast<std::uintptr_t>(address));
+            break;
+        }
+        case FormatArgs::Type::String:
+        {
+            std::uint32_t size = 0;
+            complete           = read(&size, sizeof(size)) && encoded.size() - offset >= size;
+            if (complete)
+            {
+                argument.string = {reinterpret_cast<const char*>(encoded.data() + offset), size};
+                offset += size;
+            }
+            break;
+        }
+        }
+
+        if (!complete)
+            return i;
+    }
+
+    return count;
+}
+} // namespace
+} // isc::util
+
+#if defined(__cpp_lib_format)
+template <>
+struct std::formatter<isc::util::Argument>
+{
+    // The specification is kept as-is and handed to the formatter of the argument's actual type.
+    constexpr auto parse(std::format_parse_context& context)
+    {
+        auto end = context.begin();
+        while (end != context.end() && *end != '}')
+            ++end;
+
+        m_specification = std::string_view(context.begin(), end);
+        return end;
+    }
+
+    std::format_context::iterator format(const isc::util::Argument& argument, std::format_context& context) const
+    {
+        using Type = isc::util::FormatArgs::Type;
+
+        switch (argument.type)
+        {
+        case Type::Bool:
+            return format_as(argument.boolean, context);
+        case Type::Char:
+            return format_as(argument.character, context);
+        case Type::Int:
+            return format_as(argument.integer, context);
+        case Type::UInt:
+            return format_as(argument.unsigned_integer, context);
+        case Type::Float:
+            return format_as(argument.single, context);
+        case Type::Double:
+            return format_as(argument.number, context);
+        case Type::Pointer:
+            return format_as(argument.pointer, context);
+        case Type::String:
+            break;
+        }
+
+        return format_as(argument.string, context);
+    }
+
+private:
+    template <typename T>
+    std::format_context::iterator format_as(const T& value, std::format_context& context) const
+    {
+        std::formatter<T> formatter;
+        std::format_parse_context specification(m_specification);
+        formatter.parse(specification);
+        return formatter.format(value, context);
+    }
+
+    std::string_view m_specification;
+};
+#endif
+
+namespace isc::util
+{
+namespace
+{
+#if defined(__cpp_lib_format)
+template <std::size_t... Indices>
+void format_arguments(const std::string_view format, const Argument* arguments, std::string& out, std::index_sequence<Indices...>)
+{
+    std::vformat_to(std::back_inserter(out), format, std::make_format_args(arguments[Indices]...));
+}
+
+using Formatter = void (*)(std::string_view, const Argument*, std::string&);
+
+template <std::size_t... Counts>
+consteval std::array<Formatter, sizeof...(Counts)> make_formatters(std::index_sequence<Counts...>)
+{
+    return {+[](const std::string_view format, const Argument* arguments, std::string& out) {
+        format_arguments(format, arguments, out, std::make_index_sequence<Counts>());
+    }...};
+}
+
+constexpr auto s_formatters = make_formatters(std::make_index_sequence<FormatArgs::max_arguments + 1>());
+#else
+// A standard format specification, [[fill]align][sign][#][0][width][.precision][L][type].
+struct Specification
+{
+    char fill         = ' ';
+    char align        = '\0';
+    char sign         = '-';
+    bool alternate    = false;
+    bool zero         = false;
+    std::size_t width = 0;
+    int precision     = -1;
+    char type         = '\0';
+};
+
+Specification parse_specification(const std::string_view text) noexcept
+{
+    Specification specification;
+    const char* position = text.data();
+    const char* end      = text.data() + text.size();
+    const auto is_align  = [](const char character) { return character == '<' || character == '>' || character == '^'; };
+
+    if (end - position >= 2 && is_align(position[1]))
+    {
+        specification.fill  = position[0];
+        specification.align = position[1];
+        position += 2;
+    }
+    else if (position != end && is_align(*position))
+        specification.align = *position++;
+
+    if (position != end && (*position == '+' || *position == '-' || *position == ' '))
+        specification.sign = *position++;
+    if (position != end && *position == '#')
+    {
+        specification.alternate = true;
+        ++position;
+    }
+    if (position != end && *position == '0')
+    {
+        specification.zero = true;
+        ++position;
+    }
+
+    position = std::from_chars(position, end, specification.width).ptr;
+    if (position != end && *position == '.')
+        position = std::from_chars(position + 1, end, specification.precision).ptr;
+    if (position != end && *position == 'L')
+        ++position;
+    if (position != end)
+        specification.type = *position;
+
+    return specification;
+}
+
+void to_upper(char* first, const char* last) noexcept
+{
+    for (; first != last; ++first)
+    {
+        if (*first >= 'a' && *first <= 'z')
+            *first = static_cast<char>(*first - 'a' + 'A');
+    }
+}
+
+// Appends a value padded to the width of the specification, numbers are aligned right and everything else left by default.
+void append_padded(const std::string_view prefix, const std::string_view body, const Specification& specification, const bool numeric, std::string& out)
+{
+    const std::size_t size    = prefix.size() + body.size();
+    const std::size_t padding = specification.width > size ? specification.width - size : 0;
+
+    // Zeros go between the sign or base prefix and the digits, and are ignored once an alignment is given.
+    if (numeric && specification.zero && specification.align == '\0')
+    {
+        out += prefix;
+        out.append(padding, '0');
+        out += body;
+        return;
+    }
+
+    const char align         = specification.align != '\0' ? specification.align : numeric ? '>' : '<';
+    const std::size_t before = align == '>' ? padding : align == '^' ? padding / 2 : 0;
+    out.append(before, specification.fill);
+    out += prefix;
+    out += body;
+    out.append(padding - before, specification.fill);
+}
+
+void append_integer(const bool negative, const std::uint64_t magnitude, const Specification& specification, std::string& out)
+{
+    if (specification.type == 'c')
+    {
+        const char character = static_cast<char>(magnitude);
+        append_padded({}, std::string_view(&character, 1), specification, false, out);
+        return;
+    }
+
+    int base = 10;
+    switch (specification.type)
+    {
+    case 'b':
+    case 'B':
+        base = 2;
+        break;
+    case 'o':
+        base = 8;
+        break;
+    case 'x':
+    case 'X':
+        base = 16;
+        break;
+    default:
+        break;
+    }
+
+    char prefix[3];
+    std::size_t prefix_size = 0;
+    if (negative)
+        prefix[prefix_size++] = '-';
+    else if (specification.sign != '-')
+        prefix[prefix_size++] = specification.sign;
+
+    if (specification.alternate && base != 10 && !(base == 8 && magnitude == 0))
+    {
+        prefix[prefix_size++] = '0';
+        if (base != 8)
+            prefix[prefix_size++] = specification.type;
+    }
+
+    char digits[64];
+    const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), magnitude, base);
+    if (specification.type == 'X')
+        to_upper(digits, result.ptr);
+
+    append_padded({prefix, prefix_size}, {digits, result.ptr}, specification, true, out);
+}
+
+template <typename T>
+void append_floating(const T value, const Specification& specification, std::string& out)
+{
+    char prefix[1];
+    std::size_t prefix_size = 0;
+    if (std::signbit(value))
+        prefix[prefix_size++] = '-';
+    else if (specification.sign != '-')
+        prefix[prefix_size++] = specification.sign;
+
+    const T magnitude   = std::abs(value);
+    const int precision = specification.precision;
+    char buffer[512];
+    char* const end = buffer + sizeof(buffer);
+
+    std::to_chars_result result{};
+    switch (specification.type)
+    {
+    case 'f':
+    case 'F':
+        result = std::to_chars(buffer, end, magnitude, std::chars_format::fixed, precision < 0 ? 6 : precision);
+        break;
+    case 'e':
+    case 'E':
+        result = std::to_chars(buffer, end, magnitude, std::chars_format::scientific, precision < 0 ? 6 : precision);
+        break;
+    case 'g':
+    case 'G':
+        result = std::to_chars(buffer, end, magnitude, std::chars_format::general, precision < 0 ? 6 : precision);
+        break;
+    case 'a':
+    case 'A':
+        result = precision < 0 ? std::to_chars(buffer, end, magnitude, std::chars_format::hex)
+                               : std::to_chars(buffer, end, magnitude, std::chars_format::hex, precision);
+        break;
+    default:
+        result = precision < 0 ? std::to_chars(buffer, end, magnitude)
+                               : std::to_chars(buffer, end, magnitude, std::chars_format::general, precision);
+        break;
+    }
+
+    // Only fixed notation with a huge precision overflows the buffer, the shortest representation always fits.
+    if (result.ec != std::errc())
+        result = std::to_chars(buffer, end, magnitude);
+    if (specification.type >= 'A' && specification.type <= 'Z')
+        to_upper(buffer, result.ptr);
+
+    // Infinity and NaN are never padded with zeros.
+    Specification padding = specification;
+    padding.zero          = padding.zero && std::isfinite(value);
+    append_padded({prefix, prefix_size}, {buffer, result.ptr}, padding, true, out);
+}
+
+void append_formatted(const Argument& argument, const Specification& specification, std::string& out)
+{
+    const bool as_text = specification.type == '\0' || specification.type == 's';
+
+    switch (argument.type)
+    {
+    case FormatArgs::Type::Bool:
+        if (as_text)
+            append_padded({}, argument.boolean ? "true" : "false", specification, false, out);
+        else
+            append_integer(false, argument.boolean ? 1 : 0, specification, out);
+        return;
+    case FormatArgs::Type::Char:
+        if (as_text || specification.type == 'c')
+            append_padded({}, std::string_view(&argument.character, 1), specification, false, out);
+        else
+            append_integer(false, static_cast<unsigned char>(argument.character), specification, out);
+        return;
+    case FormatArgs::Type::Int:
+        append_integer(argument.integer < 0, argument.integer < 0 ? 0 - static_cast<std::uint64_t>(argument.integer) : static_cast<std::uint64_t>(argument.integer), specification, out);
+        return;
+    case FormatArgs::Type::UInt:
+        append_integer(false, argument.unsigned_integer, specification, out);
+        return;
+    case FormatArgs::Type::Float:
+        append_floating(argument.single, specification, out);
+        return;
+    case FormatArgs::Type::Double:
+        append_floating(argument.number, specification, out);
+        return;
+    case FormatArgs::Type::Pointer:
+    {
+        char digits[16];
+        const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), reinterpret_cast<std::uintptr_t>(argument.pointer), 16);
+        append_padded("0x", {digits, result.ptr}, specification, true, out);
+        return;
+    }
+    case FormatArgs::Type::String:
+    {
+        std::string_view string = argument.string;
+        if (specification.precision >= 0)
+            string = string.substr(0, static_cast<std::size_t>(specification.precision));
+
+        append_padded({}, string, specification, false, out);
+        return;
+    }
+    }
+}
+#endif
+} // namespace
+
+FormatArgs::FormatArgs(const FormatArgs& args) noexcept
+    : m_format(args.m_format),
+      m_size(args.m_size)
+{
+    std::memcpy(m_buffer, args.m_buffer, m_size);
+
+    if (args.m_state.load(std::memory_order_acquire) == State::Rendered)
+    {
+        m_rendered = args.m_rendered;
+        m_state.store(State::Rendered, std::memory_order_relaxed);
+    }
+}
+
+FormatArgs& FormatArgs::operator=(const FormatArgs& args) noexcept
+{
+    if (&args == this)
+        return *this;
+
+    m_format = args.m_format;
+    m_size   = args.m_size;
+    std::memcpy(m_buffer, args.m_buffer, m_size);
+
+    if (args.m_state.load(std::memory_order_acquire) == State::Rendered)
+    {
+        m_rendered = args.m_rendered;
+        m_state.store(State::Rendered, std::memory_order_relaxed);
+    }
+    else
+    {
+        m_rendered = NoThrowString();
+        m_state.store(State::Pending, std::memory_order_relaxed);
+    }
+
+    return *this;
+}
+
+FormatArgs FormatArgs::from_encoded(const std::string_view format, const std::span<const std::byte> arguments) noexcept
+{
+    FormatArgs args;
+    args.m_format = format;
+    args.write(arguments.data(), std::min(arguments.size(), inline_capacity));
+    return args;
+}
+
+bool FormatArgs::empty() const noexcept
+{
+    return m_format.data() == nullptr;
+}
+
+bool FormatArgs::is_rendered() const noexcept
+{
+    return m_state.load(std::memory_order_acquire) == State::Rendered;
+}
+
+std::string_view FormatArgs::format_string() const noexcept
+{
+    return m_format;
+}
+
+std::span<const std::byte> FormatArgs::arguments() const noexcept
+{
+    return {m_buffer, m_size};
+}
+
+std::string_view FormatArgs::rendered() const noexcept
+{
+    State state = State::Pending;
+    if (m_state.compare_exchange_strong(state, State::Rendering, std::memory_order_acquire))
+    {
+        try
+        {
+            std::string out;
+            render(m_format, arguments(), out);
+            m_rendered = out;
+        }
+        catch (...)
+        {
+            m_rendered = NoThrowString::from_static(m_format);
+        }
+
+        m_state.store(State::Rendered, std::memory_order_release);
+        return m_rendered.get();
+    }
+
+    // Another thread is formatting, which only takes as long as formatting the string ourselves would.
+    while (state != State::Rendered)
+    {
+        std::this_thread::yield();
+        state = m_state.load(std::memory_order_acquire);
+    }
+
+    return m_rendered.get();
+}
+
+void FormatArgs::render(const std::string_view format, const std::span<const std::byte> arguments, std::string& out)
+{
+    std::array<Argument, max_arguments> decoded{};
+    const std::size_t count = decode(arguments, decoded);
+
+#if defined(__cpp_lib_format)
+    s_formatters[count](format, decoded.data(), out);
+#else
+    std::size_t next = 0;
+    for (std::size_t i = 0; i < format.size(); ++i)
+    {
+        const char character = format[i];
+        if ((character == '{' || character == '}') && i + 1 < format.size() && format[i + 1] == character)
+        {
+            out += character;
+            ++i;
+            continue;
+        }
+
+        if (character != '{')
+        {
+            out += character;
+            continue;
+        }
+
+        const std::size_t end = format.find('}', i);
+        if (end == std::string_view::npos)
+            break;
+
+        std::size_t index            = next++;
+        const std::string_view field = format.substr(i + 1, end - i - 1);
+        std::from_chars(field.data(), field.data() + field.size(), index);
+
+        const std::size_t colon = field.find(':');
+        if (index < count)
+            append_formatted(decoded[index], parse_specification(colon == std::string_view::npos ? std::string_view() : field.substr(colon + 1)), out);
+
+        i = end;
+    }
+#endif
+}
+
+void FormatArgs::write(const void* data, const std::size_t size) noexcept
+{
+    if (size == 0)
+        return;
+
+    std::memcpy(m_buffer + m_size, data, size);
+    m_size += static_cast<std::uint32_t>(size);
+}
+} // isc::util
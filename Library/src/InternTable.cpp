@@ -0,0 +1,215 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "InternTable.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace isc::util
+{
+InternTable& InternTable::global() noexcept
+{
+    // Never destroyed, so that interned strings stay valid while other static objects are being destroyed.
+    alignas(InternTable) static unsigned char s_storage[sizeof(InternTable)];
+    static InternTable* s_table = new(s_storage) InternTable();
+    return *s_table;
+}
+
+InternTable::InternTable() noexcept
+{
+    m_slots        = new(std::nothrow) std::atomic<std::uint64_t>[s_slot_count];
+    m_static_slots = new(std::nothrow) StaticSlot[s_slot_count];
+    m_entries      = new(std::nothrow) Entry[max_strings];
+
+    if (m_slots == nullptr || m_static_slots == nullptr || m_entries == nullptr)
+    {
+        delete[] m_slots;
+        delete[] m_static_slots;
+        delete[] m_entries;
+        m_slots        = nullptr;
+        m_static_slots = nullptr;
+        m_entries      = nullptr;
+        return;
+    }
+
+    for (std::size_t i = 0; i < s_slot_count; ++i)
+    {
+        m_slots[i].store(0, std::memory_order_relaxed);
+        m_static_slots[i].key.store(nullptr, std::memory_order_relaxed);
+        m_static_slots[i].id.store(no_id, std::memory_order_relaxed);
+    }
+}
+
+InternTable::~InternTable() noexcept
+{
+    delete[] m_slots;
+    delete[] m_static_slots;
+    delete[] m_entries;
+
+    // Every block starts with a pointer to the block allocated before it.
+    while (m_block != nullptr)
+    {
+        char* previous;
+        std::memcpy(&previous, m_block, sizeof(previous));
+        delete[] m_block;
+        m_block = previous;
+    }
+}
+
+std::uint32_t InternTable::intern(const std::string_view string) noexcept
+{
+    if (m_slots == nullptr)
+        return no_id;
+
+    const std::uint64_t string_hash = hash(string);
+    if (const std::uint32_t id = find(string, string_hash); id != no_id)
+        return id;
+
+    std::lock_guard lock(m_mutex);
+    if (const std::uint32_t id = find(string, string_hash); id != no_id)
+        return id;
+
+    const std::uint32_t size = m_size.load(std::memory_order_relaxed);
+    if (size == max_strings)
+        return no_id;
+
+    const char* data = store(string);
+    if (data == nullptr)
+        return no_id;
+
+    const std::uint32_t id = size + 1;
+    m_entries[size]        = {data, string.size()};
+    m_size.store(id, std::memory_order_release);
+
+    // Publishing the slot last means that readers who find the id also see the entry.
+    const std::uint64_t slot_value = (string_hash & 0xFFFFFFFF00000000ull) | id;
+    for (std::size_t i = string_hash & (s_slot_count - 1);; i = (i + 1) & (s_slot_count - 1))
+    {
+        if (m_slots[i].load(std::memory_order_relaxed) == 0)
+        {
+            m_slots[i].store(slot_value, std::memory_order_release);
+            break;
+        }
+    }
+
+    return id;
+}
+
+std::uint32_t InternTable::intern_static(const char* string) noexcept
+{
+    if (m_static_slots == nullptr || string == nullptr)
+        return no_id;
+
+    const auto address = reinterpret_cast<std::uintptr_t>(string);
+    const std::size_t start = (address ^ (address >> 17)) * 0x9E3779B97F4A7C15ull >> 40 & (s_slot_count - 1);
+
+    // Several addresses can hold the same text, so the slots can fill up even though the strings they intern cannot.
+    for (std::size_t probe = 0, i = start; probe < s_slot_count; ++probe, i = (i + 1) & (s_slot_count - 1))
+    {
+        const char* key = m_static_slots[i].key.load(std::memory_order_acquire);
+        if (key == string)
+            return m_static_slots[i].id.load(std::memory_order_relaxed);
+
+        if (key == nullptr)
+            break;
+    }
+
+    const std::uint32_t id = intern(string);
+    if (id == no_id)
+        return no_id;
+
+    // Once every slot is taken, the id is still returned, the address is just not remembered.
+    std::lock_guard lock(m_mutex);
+    for (std::size_t probe = 0, i = start; probe < s_slot_count; ++probe, i = (i + 1) & (s_slot_count - 1))
+    {
+        const char* key = m_static_slots[i].key.load(std::memory_order_relaxed);
+        if (key == string)
+            break;
+
+        if (key == nullptr)
+        {
+            m_static_slots[i].id.store(id, std::memory_order_relaxed);
+            m_static_slots[i].key.store(string, std::memory_order_release);
+            break;
+        }
+    }
+
+    return id;
+}
+
+std::uint32_t InternTable::find(const std::string_view string) const noexcept
+{
+    if (m_slots == nullptr)
+        return no_id;
+
+    return find(string, hash(string));
+}
+
+std::string_view InternTable::lookup(const std::uint32_t id) const noexcept
+{
+    if (id == no_id || id > m_size.load(std::memory_order_acquire))
+        return {};
+
+    const Entry& entry = m_entries[id - 1];
+    return {entry.data, entry.size};
+}
+
+std::size_t InternTable::size() const noexcept
+{
+    return m_size.load(std::memory_order_relaxed);
+}
+
+std::uint64_t InternTable::hash(const std::string_view string) noexcept
+{
+    // FNV-1a, which is plenty for the short names and paths that end up in the table.
+    std::uint64_t result = 0xCBF29CE484222325ull;
+    for (const char character : string)
+    {
+        result ^= static_cast<unsigned char>(character);
+        result *= 0x100000001B3ull;
+    }
+
+    return result;
+}
+
+std::uint32_t InternTable::find(const std::string_view string, const std::uint64_t hash) const noexcept
+{
+    const std::uint64_t tag = hash & 0xFFFFFFFF00000000ull;
+    for (std::size_t i = hash & (s_slot_count - 1);; i = (i + 1) & (s_slot_count - 1))
+    {
+        const std::uint64_t slot = m_slots[i].load(std::memory_order_acquire);
+        if (slot == 0)
+            return no_id;
+
+        const auto id = static_cast<std::uint32_t>(slot);
+        if ((slot & 0xFFFFFFFF00000000ull) == tag && lookup(id) == string)
+            return id;
+    }
+}
+
+const char* InternTable::store(const std::string_view string) noexcept
+{
+    if (m_block == nullptr || m_block_size - m_block_used < string.size())
+    {
+        // Strings too long for a regular block get a block of their own, the rest of the old block is simply left unused.
+        const std::size_t size = std::max(s_block_size, sizeof(char*) + string.size());
+        char* block            = new(std::nothrow) char[size];
+        if (block == nullptr)
+            return nullptr;
+
+        std::memcpy(block, &m_block, sizeof(m_block));
+        m_block      = block;
+        m_block_size = size;
+        m_block_used = sizeof(char*);
+    }
+
+    char* data = m_block + m_block_used;
+    if (!string.empty())
+        std::memcpy(data, string.data(), string.size());
+    m_block_used += string.size();
+    return data;
+}
+} // isc::util
@@ -6,18 +6,28 @@
 
 namespace isc
 {
-constexpr Logger::Logger(const Message::Severity threshold) noexcept
-    : m_threshold(threshold)
-{}
+void Logger::log_record_internal(const Record& record) const noexcept
+{
+    try
+    {
+        log_message_internal(record.to_message());
+    }
+    catch (...)
+    {
+        // Rebuilding the message can only fail on allocation, in which case there is nothing left to log with.
+    }
+}
 
-void Logger::log_message(const Message& message) const noexcept
+void Logger::log_shared_message_internal(const Message& message, const RenderCache&) const noexcept
 {
-    if (message.severity() >= m_threshold)
-        log_message_internal(message);
+    log_message_internal(message);
 }
 
-void Logger::set_severity(const Message::Severity& severity) noexcept
+void Logger::log_shared_record_internal(const Record& record, const RenderCache&) const noexcept
 {
-    m_threshold = severity;
+    log_record_internal(record);
 }
+
+void Logger::dump_pending_internal(util::SignalWriter&) const noexcept
+{}
 } // isc
@@ -0,0 +1,240 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "LoggerRegistry.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <csignal>
+#endif
+
+namespace isc
+{
+namespace
+{
+std::string_view trim(std::string_view string) noexcept
+{
+    const auto space = [](const char character) {
+        return character == ' ' || character == '\t' || character == '\r';
+    };
+
+    while (!string.empty() && space(string.front()))
+        string.remove_prefix(1);
+    while (!string.empty() && space(string.back()))
+        string.remove_suffix(1);
+
+    return string;
+}
+
+#if !defined(_WIN32)
+int s_debug_signal = 0;
+
+void handle_signal(const int signal) noexcept
+{
+    if (signal == s_debug_signal)
+        LoggerRegistry::global().enable_debug();
+    else
+        LoggerRegistry::global().restore();
+}
+#endif
+}
+
+template <typename Function>
+bool LoggerRegistry::visit(Entry& entry, Function&& function) noexcept
+{
+    // Announcing the read before loading the logger pairs with release, which takes the logger out before counting
+    // readers, so either this thread sees the logger gone or release sees this thread and waits for it.
+    entry.readers.fetch_add(1, std::memory_order_seq_cst);
+    Logger* logger = entry.logger.load(std::memory_order_seq_cst);
+    if (logger != nullptr)
+        function(*logger);
+
+    entry.readers.fetch_sub(1, std::memory_order_release);
+    return logger != nullptr;
+}
+
+void LoggerRegistry::release(Entry& entry, Logger* logger) noexcept
+{
+    entry.logger.store(logger, std::memory_order_seq_cst);
+    while (entry.readers.load(std::memory_order_acquire) != 0)
+        std::this_thread::yield();
+}
+
+LoggerRegistry& LoggerRegistry::global() noexcept
+{
+    static LoggerRegistry s_registry;
+    return s_registry;
+}
+
+bool LoggerRegistry::add(const std::string_view name, Logger& logger) noexcept
+{
+    if (name.size() > name_capacity)
+        return false;
+
+    std::lock_guard lock(m_mutex);
+
+    // Names keep their entry for good, so a logger that is removed and added again reuses it.
+    if (const std::size_t index = index_of(name); index != max_loggers)
+    {
+        // The logger that is replaced may be destroyed as soon as this returns, like one that is removed.
+        m_entries[index].debugging.store(false, std::memory_order_relaxed);
+        release(m_entries[index], &logger);
+        return true;
+    }
+
+    const std::size_t size = m_size.load(std::memory_order_relaxed);
+    if (size == max_loggers)
+        return false;
+
+    Entry& entry = m_entries[size];
+    std::memcpy(entry.name, name.data(), name.size());
+    entry.name_size = static_cast<std::uint8_t>(name.size());
+    entry.logger.store(&logger, std::memory_order_relaxed);
+    m_size.store(size + 1, std::memory_order_release);
+    return true;
+}
+
+void LoggerRegistry::remove(const Logger& logger) noexcept
+{
+    std::lock_guard lock(m_mutex);
+
+    const std::size_t size = m_size.load(std::memory_order_relaxed);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if (m_entries[i].logger.load(std::memory_order_relaxed) == &logger)
+            release(m_entries[i], nullptr);
+    }
+}
+
+Logger* LoggerRegistry::find(const std::string_view name) const noexcept
+{
+    const std::size_t index = index_of(name);
+    return index != max_loggers ? m_entries[index].logger.load(std::memory_order_acquire) : nullptr;
+}
+
+bool LoggerRegistry::set_severity(const std::string_view name, const Message::Severity severity) noexcept
+{
+    const auto set = [severity](Logger& logger) { logger.set_severity(severity); };
+
+    if (name != "*")
+    {
+        const std::size_t index = index_of(name);
+        return index != max_loggers && visit(m_entries[index], set);
+    }
+
+    bool found             = false;
+    const std::size_t size = m_size.load(std::memory_order_acquire);
+    for (std::size_t i = 0; i < size; ++i)
+        found = visit(m_entries[i], set) || found;
+
+    return found;
+}
+
+std::size_t LoggerRegistry::apply(std::string_view config) noexcept
+{
+    std::size_t applied = 0;
+    while (!config.empty())
+    {
+        const std::size_t end       = config.find('\n');
+        const std::string_view line = trim(config.substr(0, end));
+        config.remove_prefix(end == std::string_view::npos ? config.size() : end + 1);
+
+        const std::size_t separator = line.find('=');
+        if (line.empty() || line.front() == '#' || separator == std::string_view::npos)
+            continue;
+
+        const auto severity = Message::parse_severity(trim(line.substr(separator + 1)));
+        if (severity && set_severity(trim(line.substr(0, separator)), *severity))
+            ++applied;
+    }
+
+    return applied;
+}
+
+bool LoggerRegistry::load(const std::string& path) noexcept
+{
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr)
+        return false;
+
+    bool loaded = false;
+    try
+    {
+        std::string config;
+        char buffer[4096];
+        std::size_t read;
+        while ((read = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+            config.append(buffer, read);
+
+        loaded = std::ferror(file) == 0;
+        if (loaded)
+            apply(config);
+    }
+    catch (...)
+    {}
+
+    std::fclose(file);
+    return loaded;
+}
+
+void LoggerRegistry::enable_debug() noexcept
+{
+    const std::size_t size = m_size.load(std::memory_order_acquire);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        Entry& entry = m_entries[i];
+        visit(entry, [&entry](Logger& logger) {
+            if (entry.debugging.exchange(true, std::memory_order_relaxed))
+                return;
+
+            entry.saved.store(logger.severity(), std::memory_order_relaxed);
+            logger.set_severity(Message::Severity::Debug);
+        });
+    }
+}
+
+void LoggerRegistry::restore() noexcept
+{
+    const std::size_t size = m_size.load(std::memory_order_acquire);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        Entry& entry = m_entries[i];
+        visit(entry, [&entry](Logger& logger) {
+            if (entry.debugging.exchange(false, std::memory_order_relaxed))
+                logger.set_severity(entry.saved.load(std::memory_order_relaxed));
+        });
+    }
+}
+
+#if !defined(_WIN32)
+bool LoggerRegistry::install_signal_handlers(const int debug_signal, const int restore_signal) noexcept
+{
+    // Constructs the registry now, a signal handler must not be the first to touch a function local static.
+    static_cast<void>(global());
+    s_debug_signal = debug_signal;
+
+    struct sigaction action{};
+    action.sa_handler = handle_signal;
+    action.sa_flags   = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+
+    return ::sigaction(debug_signal, &action, nullptr) == 0 && ::sigaction(restore_signal, &action, nullptr) == 0;
+}
+#endif
+
+std::size_t LoggerRegistry::index_of(const std::string_view name) const noexcept
+{
+    const std::size_t size = m_size.load(std::memory_order_acquire);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if (std::string_view(m_entries[i].name, m_entries[i].name_size) == name)
+            return i;
+    }
+
+    return max_loggers;
+}
+} // isc
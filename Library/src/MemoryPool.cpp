@@ -0,0 +1,170 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "MemoryPool.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <new>
+
+namespace isc::util
+{
+namespace
+{
+std::size_t size_class_of(const std::size_t size) noexcept
+{
+    return static_cast<std::size_t>(std::bit_width((std::max(size, MemoryPool::min_block_size) - 1) | 31)) - 5;
+}
+
+std::size_t block_size_of(const std::size_t size_class) noexcept
+{
+    return MemoryPool::min_block_size << size_class;
+}
+} // namespace
+
+MemoryPool::ThreadCache::~ThreadCache() noexcept
+{
+    while (slabs != nullptr)
+    {
+        void* previous = *static_cast<void**>(slabs);
+        ::operator delete(slabs);
+        slabs = previous;
+    }
+}
+
+MemoryPool::MemoryPool() noexcept
+= default;
+
+MemoryPool::~MemoryPool() noexcept
+= default;
+
+MemoryPool& MemoryPool::global() noexcept
+{
+    // Never destroyed, so that blocks can still be freed while other static objects are being destroyed.
+    alignas(MemoryPool) static unsigned char s_storage[sizeof(MemoryPool)];
+    static MemoryPool* s_pool = new(s_storage) MemoryPool();
+    return *s_pool;
+}
+
+void* MemoryPool::allocate_block(const std::size_t size) noexcept
+{
+    ThreadCache* cache = size <= max_block_size ? local_cache() : nullptr;
+    if (cache == nullptr)
+    {
+        void* memory = ::operator new(sizeof(Header) + size, std::nothrow);
+        if (memory == nullptr)
+            return nullptr;
+
+        ::new(memory) Header{nullptr, s_class_count};
+        return static_cast<char*>(memory) + block_alignment;
+    }
+
+    const std::size_t size_class = size_class_of(size);
+
+    FreeBlock* block = cache->local[size_class];
+    if (block == nullptr)
+        block = cache->returned[size_class].exchange(nullptr, std::memory_order_acquire);
+
+    if (block == nullptr)
+        return refill(*cache, size_class);
+
+    cache->local[size_class] = block->next;
+    return block;
+}
+
+void MemoryPool::deallocate_block(void* block) noexcept
+{
+    if (block == nullptr)
+        return;
+
+    const Header* header = reinterpret_cast<const Header*>(static_cast<char*>(block) - block_alignment);
+    ThreadCache* cache   = header->cache;
+    if (cache == nullptr)
+    {
+        ::operator delete(static_cast<char*>(block) - block_alignment);
+        return;
+    }
+
+    auto* freed = static_cast<FreeBlock*>(block);
+    if (cache->owned())
+    {
+        freed->next                      = cache->local[header->size_class];
+        cache->local[header->size_class] = freed;
+        return;
+    }
+
+    // Another thread's block, the owner only ever takes the whole stack, so there is no ABA problem to worry about.
+    std::atomic<FreeBlock*>& returned = cache->returned[header->size_class];
+    freed->next                       = returned.load(std::memory_order_relaxed);
+    while (!returned.compare_exchange_weak(freed->next, freed, std::memory_order_release, std::memory_order_relaxed))
+    {}
+}
+
+std::size_t MemoryPool::reserved() const noexcept
+{
+    return m_reserved.load(std::memory_order_relaxed);
+}
+
+void* MemoryPool::do_allocate(const std::size_t bytes, const std::size_t alignment)
+{
+    if (alignment > block_alignment)
+        return ::operator new(bytes, std::align_val_t(alignment));
+
+    void* block = allocate_block(bytes);
+    if (block == nullptr)
+        throw std::bad_alloc();
+
+    return block;
+}
+
+void MemoryPool::do_deallocate(void* pointer, const std::size_t bytes, const std::size_t alignment)
+{
+    if (alignment > block_alignment)
+    {
+        ::operator delete(pointer, bytes, std::align_val_t(alignment));
+        return;
+    }
+
+    deallocate_block(pointer);
+}
+
+bool MemoryPool::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+MemoryPool::ThreadCache* MemoryPool::local_cache() noexcept
+{
+    // The caches of threads that have exited still hold their blocks, so they are handed on rather than wasted.
+    return m_caches.local([this] {
+        auto cache  = std::make_shared<ThreadCache>();
+        cache->pool = this;
+        return cache;
+    });
+}
+
+void* MemoryPool::refill(ThreadCache& cache, const std::size_t size_class) noexcept
+{
+    const std::size_t stride = block_alignment + block_size_of(size_class);
+    if (static_cast<std::size_t>(cache.bump_end - cache.bump) < stride)
+    {
+        // What is left of the previous slab is too small for this class, so it goes unused.
+        void* slab = ::operator new(slab_size, std::nothrow);
+        if (slab == nullptr)
+            return nullptr;
+
+        *static_cast<void**>(slab) = cache.slabs;
+        cache.slabs                = slab;
+        cache.bump                 = static_cast<char*>(slab) + block_alignment;
+        cache.bump_end             = static_cast<char*>(slab) + slab_size;
+        cache.pool->m_reserved.fetch_add(slab_size, std::memory_order_relaxed);
+    }
+
+    char* memory = cache.bump;
+    cache.bump += stride;
+
+    ::new(memory) Header{&cache, size_class};
+    return memory + block_alignment;
+}
+} // isc::util
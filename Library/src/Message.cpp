@@ -4,8 +4,11 @@
 
 #include "Message.hpp"
 
+#include "CodeRegistry.hpp"
+
+#include <algorithm>
 #include <filesystem>
-#include <sstream>
+#include <thread>
 #include <utility>
 
 namespace isc
@@ -34,6 +37,18 @@ Message::Message()
 Message::~Message()
 = default;
 
+Message::Message(const Message& message) noexcept
+= default;
+
+Message& Message::operator=(const Message& message) noexcept
+= default;
+
+Message::Message(Message&& message) noexcept
+= default;
+
+Message& Message::operator=(Message&& message) noexcept
+= default;
+
 Message::Message(
     const unsigned int code,
     util::NoThrowString name,
@@ -45,134 +60,248 @@ Message::Message(
       m_name(std::move(name)),
       m_description(std::move(description)),
       m_severity(severity),
-      m_source_location(location),
-      m_temp_string(nullptr)
+      m_source_location(location)
+{}
+
+Message::Message(
+    const unsigned int code,
+    util::NoThrowString name,
+    const Severity severity,
+    const std::source_location& location
+)
+    : m_code(code),
+      m_name(std::move(name)),
+      m_has_description(false),
+      m_severity(severity),
+      m_source_location(location)
 {}
 
 Message::Message(
     const unsigned int code,
     util::NoThrowString name,
+    util::FormatArgs description,
     const Severity severity,
     const std::source_location& location
 )
     : m_code(code),
       m_name(std::move(name)),
+      m_format(std::move(description)),
+      m_severity(severity),
+      m_source_location(location)
+{}
+
+Message::Message(
+    util::MemoryPool& pool,
+    const unsigned int code,
+    const std::string_view name,
+    const std::string_view description,
+    const Severity severity,
+    const std::source_location& location
+)
+    : m_code(code),
+      m_name(name, pool),
+      m_description(description, pool),
+      m_severity(severity),
+      m_source_location(location),
+      m_pool(&pool),
+      m_trace(pool)
+{}
+
+Message::Message(
+    util::MemoryPool& pool,
+    const unsigned int code,
+    const std::string_view name,
+    const Severity severity,
+    const std::source_location& location
+)
+    : m_code(code),
+      m_name(name, pool),
       m_has_description(false),
       m_severity(severity),
       m_source_location(location),
-      m_temp_string(nullptr)
+      m_pool(&pool),
+      m_trace(pool)
 {}
 
-char const* Message::what() const
-{
-    const std::string msg = message();
-    m_temp_string         = new(std::nothrow) char[msg.size() + 1];
+Message::Message(const CodeInfo& info, const std::source_location& location) noexcept
+    : m_code(info.code),
+      m_name(util::NoThrowString::from_static(info.name)),
+      m_has_description(!info.description.empty()),
+      m_description(util::NoThrowString::from_static(info.description)),
+      m_severity(info.severity),
+      m_source_location(location)
+{}
+
+Message::Message(const CodeInfo& info, util::NoThrowString description, const std::source_location& location) noexcept
+    : m_code(info.code),
+      m_name(util::NoThrowString::from_static(info.name)),
+      m_description(std::move(description)),
+      m_severity(info.severity),
+      m_source_location(location)
+{}
 
-    strcpy_s(m_temp_string, msg.size() * sizeof(char), msg.c_str());
-    return m_temp_string;
+char const* Message::what() const noexcept
+{
+    return m_what.get(*this);
 }
 
 std::string Message::message() const
 {
-    std::ostringstream oss;
-
-    std::string severity;
+    std::string out;
+    format_to(out);
+    return out;
+}
 
-    switch (m_severity)
+void Message::format_to(std::string& out) const
+{
+    out += '[';
+    out += severity_name(m_severity);
+    out += "]: ";
+    out += m_name.get();
+    if (has_description())
     {
-    case Severity::Debug:
-        severity = "[Debug]";
-        break;
-    case Severity::Nominal:
-        severity = "[Nominal]";
-        break;
-    case Severity::Notice:
-        severity = "[Notice]";
-        break;
-    case Severity::Warning:
-        severity = "[Warning]";
-        break;
-    case Severity::Error:
-        severity = "[Error]";
-        break;
-    case Severity::Fatal:
-        severity = "[Fatal]";
-        break;
+        out += " - ";
+        out += description();
     }
 
-    oss << severity << ": " << m_name.get();
-    if (has_description())
-        oss << " - " << m_description.get();
-    return oss.str();
+    util::Fields::format_to(m_fields.view(), out);
 }
 
-bool Message::is_failure() const noexcept
+std::optional<Message::Severity> Message::parse_severity(const std::string_view name) noexcept
 {
-    return m_severity >= Severity::Error;
+    const auto lower = [](const char character) {
+        return character >= 'A' && character <= 'Z' ? static_cast<char>(character - 'A' + 'a') : character;
+    };
+
+    for (int i = static_cast<int>(Severity::Debug); i <= static_cast<int>(Severity::Fatal); ++i)
+    {
+        const auto severity              = static_cast<Severity>(i);
+        const std::string_view candidate = severity_name(severity);
+        if (candidate.size() == name.size() && std::equal(candidate.begin(), candidate.end(), name.begin(), [&](const char a, const char b) {
+                return lower(a) == lower(b);
+            }))
+            return severity;
+    }
+
+    return std::nullopt;
 }
 
-Message Message::add_trace(const std::string& message) noexcept
+Message& Message::add_trace(const std::string_view message) & noexcept
 {
-    m_trace.push_back(message);
+    m_trace.append(message);
     return *this;
 }
 
-const std::list<std::string>& Message::get_trace() const noexcept
+Message Message::add_trace(const std::string_view message) && noexcept
 {
-    return m_trace;
+    m_trace.append(message);
+    return std::move(*this);
 }
 
-unsigned int Message::code() const noexcept
+std::string_view Message::description() const noexcept
 {
-    return m_code;
-}
+    if (!m_format.empty())
+        return m_format.rendered();
 
-bool Message::has_description() const noexcept
-{
-    return m_has_description;
+    return m_description.get();
 }
 
-std::string_view Message::name() const noexcept
+std::string_view Message::function(const std::string& relative_to) const noexcept
 {
-    return m_name.get();
+    return get_filename(m_source_location, relative_to);
 }
 
-std::string_view Message::description() const noexcept
+Message& Message::promote(const Severity& severity) & noexcept
 {
-    return m_description.get();
-}
+    if (m_severity < severity)
+    {
+        m_severity = severity;
+        m_what.reset();
+    }
 
-Message::Severity Message::severity() const noexcept
-{
-    return m_severity;
+    return *this;
 }
 
-unsigned int Message::line() const noexcept
+Message Message::promote(const Severity& severity) && noexcept
 {
-    return m_source_location.line();
+    if (m_severity < severity)
+    {
+        m_severity = severity;
+        m_what.reset();
+    }
+
+    return std::move(*this);
 }
 
-unsigned int Message::column() const noexcept
+Message::WhatCache::WhatCache(const WhatCache& cache) noexcept
 {
-    return m_source_location.column();
+    if (cache.m_state.load(std::memory_order_acquire) == State::Rendered)
+    {
+        m_text = cache.m_text;
+        m_state.store(State::Rendered, std::memory_order_relaxed);
+    }
 }
 
-std::string_view Message::file() const noexcept
+Message::WhatCache& Message::WhatCache::operator=(const WhatCache& cache) noexcept
 {
-    return m_source_location.file_name();
+    if (&cache == this)
+        return *this;
+
+    if (cache.m_state.load(std::memory_order_acquire) == State::Rendered)
+    {
+        m_text = cache.m_text;
+        m_state.store(State::Rendered, std::memory_order_relaxed);
+    }
+    else
+        reset();
+
+    return *this;
 }
 
-std::string_view Message::function(const std::string& relative_to) const noexcept
+const char* Message::WhatCache::get(const Message& message) const noexcept
 {
-    return get_filename(m_source_location, relative_to);
+    State state = m_state.load(std::memory_order_acquire);
+    if (state == State::Rendered)
+        return m_text.get().data();
+
+    if (state == State::Pending && m_state.compare_exchange_strong(state, State::Rendering, std::memory_order_acquire))
+    {
+        // Formatted into a buffer reused by the thread, so the only allocation is the one the text is kept in.
+        thread_local std::string t_text;
+        try
+        {
+            t_text.clear();
+            message.format_to(t_text);
+            t_text += '\0';
+            const std::string_view text(t_text);
+            m_text = message.m_pool != nullptr ? util::NoThrowString(text, *message.m_pool) : util::NoThrowString(text);
+        }
+        catch (...)
+        {}
+
+        // The text is kept with its terminator, if it is missing the text was cut short and the severity name is used instead.
+        const std::string_view text = m_text.get();
+        if (text.empty() || text.back() != '\0')
+            m_text = util::NoThrowString::from_static(severity_name(message.severity()));
+
+        m_state.store(State::Rendered, std::memory_order_release);
+        return m_text.get().data();
+    }
+
+    // Another thread is formatting, which only takes as long as formatting the string ourselves would.
+    while (state != State::Rendered)
+    {
+        std::this_thread::yield();
+        state = m_state.load(std::memory_order_acquire);
+    }
+
+    return m_text.get().data();
 }
 
-Message Message::promote(const Severity& severity) noexcept
+void Message::WhatCache::reset() noexcept
 {
-    if (m_severity < severity)
-        m_severity = severity;
-
-    return *this;
+    m_text = util::NoThrowString();
+    m_state.store(State::Pending, std::memory_order_relaxed);
 }
 
 NominalMessage::NominalMessage(
@@ -181,7 +310,7 @@ NominalMessage::NominalMessage(
     util::NoThrowString description,
     const std::source_location& location
 )
-    : Message(code, std::move(name), std::move(description), Severity::Nominal, location)
+    : SeverityMessage(std::in_place, code, std::move(name), std::move(description), Severity::Nominal, location)
 {}
 
 NominalMessage::NominalMessage(
@@ -189,7 +318,7 @@ NominalMessage::NominalMessage(
     util::NoThrowString name,
     const std::source_location& location
 )
-    : Message(code, std::move(name), Severity::Nominal, location)
+    : SeverityMessage(std::in_place, code, std::move(name), Severity::Nominal, location)
 {}
 
 DebugMessage::DebugMessage(
@@ -198,7 +327,7 @@ DebugMessage::DebugMessage(
     util::NoThrowString description,
     const std::source_location& location
 )
-    : Message(code, std::move(name), std::move(description), Severity::Nominal, location)
+    : SeverityMessage(std::in_place, code, std::move(name), std::move(description), Severity::Debug, location)
 {}
 
 DebugMessage::DebugMessage(
@@ -206,7 +335,7 @@ DebugMessage::DebugMessage(
     util::NoThrowString name,
     const std::source_location& location
 )
-    : Message(code, std::move(name), Severity::Nominal, location)
+    : SeverityMessage(std::in_place, code, std::move(name), Severity::Debug, location)
 {}
 
 NoticeMessage::NoticeMessage(
@@ -215,7 +344,7 @@ NoticeMessage::NoticeMessage(
     util::NoThrowString description,
     const std::source_location& location
 )
-    : Message(code, std::move(name), std::move(description), Severity::Nominal, location)
+    : SeverityMessage(std::in_place, code, std::move(name), std::move(description), Severity::Notice, location)
 {}
 
 NoticeMessage::NoticeMessage(
@@ -223,7 +352,7 @@ NoticeMessage::NoticeMessage(
     util::NoThrowString name,
     const std::source_location& location
 )
-    : Message(code, std::move(name), Severity::Nominal, location)
+    : SeverityMessage(std::in_place, code, std::move(name), Severity::Notice, location)
 {}
 
 WarningMessage::WarningMessage(
@@ -232,7 +361,7 @@ WarningMessage::WarningMessage(
     util::NoThrowString description,
     const std::source_location& location
 )
-    : Message(code, std::move(name), std::move(description), Severity::Nominal, location)
+    : SeverityMessage(std::in_place, code, std::move(name), std::move(description), Severity::Warning, location)
 {}
 
 WarningMessage::WarningMessage(
@@ -240,7 +369,7 @@ WarningMessage::WarningMessage(
     util::NoThrowString name,
     const std::source_location& location
 )
-    : Message(code, std::move(name), Severity::Nominal, location)
+    : SeverityMessage(std::in_place, code, std::move(name), Severity::Warning, location)
 {}
 
 ErrorMessage::ErrorMessage(
@@ -249,7 +378,7 @@ ErrorMessage::ErrorMessage(
     util::NoThrowString description,
     const std::source_location& location
 )
-    : Message(code, std::move(name), std::move(description), Severity::Nominal, location)
+    : SeverityMessage(std::in_place, code, std::move(name), std::move(description), Severity::Error, location)
 {}
 
 ErrorMessage::ErrorMessage(
@@ -257,7 +386,7 @@ ErrorMessage::ErrorMessage(
     util::NoThrowString name,
     const std::source_location& location
 )
-    : Message(code, std::move(name), Severity::Nominal, location)
+    : SeverityMessage(std::in_place, code, std::move(name), Severity::Error, location)
 {}
 
 FatalMessage::FatalMessage(
@@ -266,7 +395,7 @@ FatalMessage::FatalMessage(
     util::NoThrowString description,
     const std::source_location& location
 )
-    : Message(code, std::move(name), std::move(description), Severity::Nominal, location)
+    : SeverityMessage(std::in_place, code, std::move(name), std::move(description), Severity::Fatal, location)
 {}
 
 FatalMessage::FatalMessage(
@@ -274,6 +403,6 @@ FatalMessage::FatalMessage(
     util::NoThrowString name,
     const std::source_location& location
 )
-    : Message(code, std::move(name), Severity::Nominal, location)
+    : SeverityMessage(std::in_place, code, std::move(name), Severity::Fatal, location)
 {}
 } // isc
@@ -0,0 +1,239 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "Metrics.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <system_error>
+
+namespace isc
+{
+namespace
+{
+// The histogram is exported with a bucket at every power of two from 64 ns to 16 s, finer buckets are only in snapshots.
+constexpr std::size_t s_first_exported_power = 6;
+constexpr std::size_t s_last_exported_power  = 34;
+
+void append_number(std::string& out, const std::uint64_t value)
+{
+    char buffer[24];
+    const int length = std::snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(value));
+    out.append(buffer, static_cast<std::size_t>(length));
+}
+
+void append_seconds(std::string& out, const std::uint64_t nanoseconds)
+{
+    char buffer[32];
+    const int length = std::snprintf(buffer, sizeof(buffer), "%.9g", static_cast<double>(nanoseconds) / 1e9);
+    out.append(buffer, static_cast<std::size_t>(length));
+}
+
+void append_header(std::string& out, const std::string_view prefix, const std::string_view name, const std::string_view type, const std::string_view help)
+{
+    out.append("# HELP ").append(prefix).append(name).append(" ").append(help).append("\n");
+    out.append("# TYPE ").append(prefix).append(name).append(" ").append(type).append("\n");
+}
+
+void append_by_severity(
+    std::string& out,
+    const std::string_view prefix,
+    const std::string_view name,
+    const std::string_view help,
+    const std::array<std::uint64_t, Metrics::severity_count>& counts
+)
+{
+    append_header(out, prefix, name, "counter", help);
+    for (std::size_t i = 0; i < counts.size(); ++i)
+    {
+        out.append(prefix).append(name).append("{severity=\"");
+        out.append(Message::severity_name(static_cast<Message::Severity>(i))).append("\"} ");
+        append_number(out, counts[i]);
+        out += '\n';
+    }
+}
+
+void append_value(std::string& out, const std::string_view prefix, const std::string_view name, const std::string_view type, const std::string_view help, const std::uint64_t value)
+{
+    append_header(out, prefix, name, type, help);
+    out.append(prefix).append(name).append(" ");
+    append_number(out, value);
+    out += '\n';
+}
+}
+
+std::uint64_t Metrics::Histogram::percentile(const double fraction) const noexcept
+{
+    if (count == 0)
+        return 0;
+
+    // The rank of the value, counting from 1, so that the 0th percentile is the lowest value and the 100th the highest.
+    const double clamped = std::clamp(fraction, 0.0, 1.0);
+    const auto rank      = std::max<std::uint64_t>(static_cast<std::uint64_t>(clamped * static_cast<double>(count) + 0.5), 1);
+
+    std::uint64_t seen = 0;
+    for (std::size_t bucket = 0; bucket < bucket_count; ++bucket)
+    {
+        seen += counts[bucket];
+        if (seen >= rank)
+            return std::min(upper_bound(bucket), max);
+    }
+
+    return max;
+}
+
+void Metrics::count_logged(const Message::Severity severity, const std::uint64_t nanoseconds) noexcept
+{
+    Shard* shard = local_shard();
+    if (shard == nullptr)
+        return;
+
+    add(shard->logged[static_cast<std::size_t>(severity)], 1);
+    add(shard->latency[Histogram::bucket_of(nanoseconds)], 1);
+    add(shard->latency_sum, nanoseconds);
+    if (nanoseconds > shard->latency_max.load(std::memory_order_relaxed))
+        shard->latency_max.store(nanoseconds, std::memory_order_relaxed);
+}
+
+void Metrics::count_filtered(const Message::Severity severity) noexcept
+{
+    if (Shard* shard = local_shard(); shard != nullptr)
+        add(shard->filtered[static_cast<std::size_t>(severity)], 1);
+}
+
+void Metrics::count_bytes(const std::uint64_t bytes) noexcept
+{
+    if (Shard* shard = local_shard(); shard != nullptr)
+        add(shard->bytes_written, bytes);
+}
+
+void Metrics::count_dropped(const std::uint64_t messages) noexcept
+{
+    if (Shard* shard = local_shard(); shard != nullptr)
+        add(shard->dropped, messages);
+}
+
+void Metrics::set_queue_depth(const std::uint64_t depth) noexcept
+{
+    m_queue_depth.store(depth, std::memory_order_relaxed);
+    if (depth > m_queue_high_water.load(std::memory_order_relaxed))
+        m_queue_high_water.store(depth, std::memory_order_relaxed);
+}
+
+Metrics::Snapshot Metrics::snapshot() const noexcept
+{
+    Snapshot snapshot;
+    snapshot.queue_depth      = m_queue_depth.load(std::memory_order_relaxed);
+    snapshot.queue_high_water = m_queue_high_water.load(std::memory_order_relaxed);
+
+    std::lock_guard lock(m_shards.mutex());
+    for (const std::shared_ptr<Shard>& shard : m_shards.slots())
+    {
+        for (std::size_t i = 0; i < severity_count; ++i)
+        {
+            snapshot.logged[i] += shard->logged[i].load(std::memory_order_relaxed);
+            snapshot.filtered[i] += shard->filtered[i].load(std::memory_order_relaxed);
+        }
+
+        snapshot.bytes_written += shard->bytes_written.load(std::memory_order_relaxed);
+        snapshot.dropped += shard->dropped.load(std::memory_order_relaxed);
+
+        for (std::size_t i = 0; i < Histogram::bucket_count; ++i)
+        {
+            const std::uint64_t count = shard->latency[i].load(std::memory_order_relaxed);
+            snapshot.latency.counts[i] += count;
+            snapshot.latency.count += count;
+        }
+        snapshot.latency.sum += shard->latency_sum.load(std::memory_order_relaxed);
+        snapshot.latency.max = std::max(snapshot.latency.max, shard->latency_max.load(std::memory_order_relaxed));
+    }
+
+    return snapshot;
+}
+
+void Metrics::format_prometheus(const Snapshot& snapshot, std::string& out, const std::string_view prefix)
+{
+    append_by_severity(out, prefix, "_messages_logged_total", "Messages passed on to the sink, by severity.", snapshot.logged);
+    append_by_severity(out, prefix, "_messages_filtered_total", "Messages the sink's threshold filtered out, by severity.", snapshot.filtered);
+    append_value(out, prefix, "_bytes_written_total", "counter", "Bytes written by the sinks.", snapshot.bytes_written);
+    append_value(out, prefix, "_messages_dropped_total", "counter", "Messages dropped because a queue was full.", snapshot.dropped);
+    append_value(out, prefix, "_queue_depth", "gauge", "Messages in the queue when the worker last looked.", snapshot.queue_depth);
+    append_value(out, prefix, "_queue_high_water", "gauge", "The most messages the worker has seen in the queue.", snapshot.queue_high_water);
+
+    const std::string_view name = "_sink_latency_seconds";
+    append_header(out, prefix, name, "histogram", "How long the sink took to log a message.");
+
+    // Fine buckets nest in powers of two, so every exported bucket is the sum of the fine buckets below its bound.
+    std::uint64_t cumulative = 0;
+    std::size_t bucket       = 0;
+    for (std::size_t power = s_first_exported_power; power <= s_last_exported_power; ++power)
+    {
+        const std::uint64_t bound = std::uint64_t(1) << power;
+        for (; bucket < Histogram::bucket_count && Histogram::upper_bound(bucket) < bound; ++bucket)
+            cumulative += snapshot.latency.counts[bucket];
+
+        out.append(prefix).append(name).append("_bucket{le=\"");
+        append_seconds(out, bound);
+        out.append("\"} ");
+        append_number(out, cumulative);
+        out += '\n';
+    }
+
+    out.append(prefix).append(name).append("_bucket{le=\"+Inf\"} ");
+    append_number(out, snapshot.latency.count);
+    out.append("\n").append(prefix).append(name).append("_sum ");
+    append_seconds(out, snapshot.latency.sum);
+    out.append("\n").append(prefix).append(name).append("_count ");
+    append_number(out, snapshot.latency.count);
+    out += '\n';
+}
+
+bool Metrics::write_prometheus(const std::string& path, const std::string_view prefix) const noexcept
+{
+    try
+    {
+        std::string text;
+        format_prometheus(snapshot(), text, prefix);
+
+        const std::string temporary = path + ".tmp";
+        std::FILE* file             = std::fopen(temporary.c_str(), "wb");
+        if (file == nullptr)
+            return false;
+
+        const bool written = std::fwrite(text.data(), 1, text.size(), file) == text.size();
+        if (std::fclose(file) != 0 || !written)
+        {
+            std::remove(temporary.c_str());
+            return false;
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temporary, path, error);
+        if (error)
+        {
+            std::remove(temporary.c_str());
+            return false;
+        }
+
+        return true;
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
+
+Metrics::Shard* Metrics::local_shard() noexcept
+{
+    // The shards of threads that have exited are taken over, their counts carry on from where they were.
+    return m_shards.local([] { return std::make_shared<Shard>(); });
+}
+
+void Metrics::add(std::atomic<std::uint64_t>& counter, const std::uint64_t amount) noexcept
+{
+    // Only the owning thread writes to the counter, so there is no other write to lose between the load and the store.
+    counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+} // isc
@@ -0,0 +1,50 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "MetricsLogger.hpp"
+
+#include <chrono>
+
+namespace isc
+{
+namespace
+{
+std::uint64_t elapsed_since(const std::chrono::steady_clock::time_point start) noexcept
+{
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+}
+}
+
+MetricsLogger::MetricsLogger(Logger& sink, Metrics& metrics) noexcept
+    : Logger(Message::Severity::Debug),
+      m_sink(sink),
+      m_metrics(metrics)
+{}
+
+void MetricsLogger::log_message_internal(const Message& message) const noexcept
+{
+    if (!m_sink.should_log(message.severity()))
+    {
+        m_metrics.count_filtered(message.severity());
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    m_sink.log_message(message);
+    m_metrics.count_logged(message.severity(), elapsed_since(start));
+}
+
+void MetricsLogger::log_record_internal(const Record& record) const noexcept
+{
+    if (!m_sink.should_log(record.severity()))
+    {
+        m_metrics.count_filtered(record.severity());
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    m_sink.log_record(record);
+    m_metrics.count_logged(record.severity(), elapsed_since(start));
+}
+} // isc
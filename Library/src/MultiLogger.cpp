@@ -0,0 +1,78 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "MultiLogger.hpp"
+
+#include <algorithm>
+
+namespace isc
+{
+MultiLogger::MultiLogger() noexcept
+    : Logger(Message::Severity::Fatal)
+{}
+
+bool MultiLogger::add_sink(const Logger& sink, const Message::Severity threshold) noexcept
+{
+    std::lock_guard lock(m_mutex);
+
+    const std::size_t count = m_sink_count.load(std::memory_order_relaxed);
+    if (count == max_sinks)
+        return false;
+
+    m_sinks[count] = {&sink, threshold};
+    m_sink_count.store(count + 1, std::memory_order_release);
+
+    // The first sink decides the threshold, after that it can only be lowered.
+    const Message::Severity previous = m_sinks_threshold;
+    m_sinks_threshold                = count == 0 ? threshold : std::min(m_sinks_threshold, threshold);
+
+    // Anything else than the sinks' threshold was set on purpose, and is left alone.
+    if (severity() == previous)
+        set_severity(m_sinks_threshold);
+    return true;
+}
+
+std::size_t MultiLogger::sink_count() const noexcept
+{
+    return m_sink_count.load(std::memory_order_acquire);
+}
+
+void MultiLogger::log_message_internal(const Message& message) const noexcept
+{
+    const RenderCache cache(message);
+    log_shared_message_internal(message, cache);
+}
+
+void MultiLogger::log_record_internal(const Record& record) const noexcept
+{
+    const RenderCache cache(record);
+    log_shared_record_internal(record, cache);
+}
+
+void MultiLogger::log_shared_message_internal(const Message& message, const RenderCache& cache) const noexcept
+{
+    const Message::Severity severity = message.severity();
+    const std::size_t count          = m_sink_count.load(std::memory_order_acquire);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const Sink& sink = m_sinks[i];
+        if (severity >= sink.threshold && sink.logger->should_log(severity))
+            sink.logger->log_shared_message_internal(message, cache);
+    }
+}
+
+void MultiLogger::log_shared_record_internal(const Record& record, const RenderCache& cache) const noexcept
+{
+    const Message::Severity severity = record.severity();
+    const std::size_t count          = m_sink_count.load(std::memory_order_acquire);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const Sink& sink = m_sinks[i];
+        if (severity >= sink.threshold && sink.logger->should_log(severity))
+            sink.logger->log_shared_record_internal(record, cache);
+    }
+}
+} // isc
@@ -4,32 +4,53 @@
 
 #include "NoThrowString.hpp"
 
+#include "InternTable.hpp"
+#include "MemoryPool.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <new>
+
 namespace isc::util
 {
 NoThrowString::NoThrowString() noexcept
-= default;
+    : m_static(s_default_string.data()),
+      m_size(static_cast<std::uint32_t>(s_default_string.size()))
+{}
 
 NoThrowString::NoThrowString(const char* string) noexcept
+    : NoThrowString()
 {
-    m_str = new(std::nothrow) std::string(string);
+    if (string != nullptr)
+        assign(string);
 }
 
 NoThrowString::NoThrowString(const std::string& string) noexcept
+    : NoThrowString(std::string_view(string))
+{}
+
+NoThrowString::NoThrowString(const std::string_view string) noexcept
+    : NoThrowString()
+{
+    assign(string);
+}
+
+NoThrowString::NoThrowString(const std::string_view string, MemoryPool& pool) noexcept
+    : NoThrowString()
 {
-    m_str = new(std::nothrow) std::string(string);
+    assign(string, &pool);
 }
 
 NoThrowString::~NoThrowString() noexcept
 {
-    delete m_str;
+    reset();
 }
 
 NoThrowString::NoThrowString(const NoThrowString& string) noexcept
+    : NoThrowString()
 {
-    if (string.m_str == nullptr)
-        m_str = nullptr;
-    else
-        m_str = new(std::nothrow) std::string(*string.m_str);
+    copy_from(string);
 }
 
 NoThrowString& NoThrowString::operator=(const NoThrowString& string) noexcept
@@ -37,20 +58,16 @@ NoThrowString& NoThrowString::operator=(const NoThrowString& string) noexcept
     if (&string == this)
         return *this;
 
-    delete m_str;
-
-    if (string.m_str == nullptr)
-        m_str = nullptr;
-    else
-        m_str = new(std::nothrow) std::string(*string.m_str);
+    reset();
+    copy_from(string);
 
     return *this;
 }
 
 NoThrowString::NoThrowString(NoThrowString&& string) noexcept
+    : NoThrowString()
 {
-    m_str        = string.m_str;
-    string.m_str = nullptr;
+    steal_from(string);
 }
 
 NoThrowString& NoThrowString::operator=(NoThrowString&& string) noexcept
@@ -58,18 +75,144 @@ NoThrowString& NoThrowString::operator=(NoThrowString&& string) noexcept
     if (&string == this)
         return *this;
 
-    delete m_str;
-    m_str        = string.m_str;
-    string.m_str = nullptr;
+    reset();
+    steal_from(string);
 
     return *this;
 }
 
+NoThrowString NoThrowString::from_static(const std::string_view string) noexcept
+{
+    NoThrowString result;
+    result.m_static = string.data();
+    result.m_size   = static_cast<std::uint32_t>(std::min<std::size_t>(string.size(), std::numeric_limits<std::uint32_t>::max()));
+    return result;
+}
+
+NoThrowString NoThrowString::interned(const std::string_view string) noexcept
+{
+    InternTable& table     = InternTable::global();
+    const std::uint32_t id = table.intern(string);
+    if (id == InternTable::no_id)
+        return NoThrowString(string);
+
+    const std::string_view stored = table.lookup(id);
+
+    NoThrowString result;
+    result.m_interned = {stored.data(), id};
+    result.m_size     = static_cast<std::uint32_t>(stored.size());
+    result.m_storage  = Storage::Interned;
+    return result;
+}
+
 std::string_view NoThrowString::get() const noexcept
 {
-    if (m_str == nullptr)
-        return s_default_string;
+    switch (m_storage)
+    {
+    case Storage::Inline:
+        return {m_inline, m_size};
+    case Storage::Shared:
+        return {m_shared->data, m_size};
+    case Storage::Interned:
+        return {m_interned.data, m_size};
+    case Storage::Static:
+        break;
+    }
+
+    return {m_static, m_size};
+}
+
+std::uint32_t NoThrowString::id() const noexcept
+{
+    return m_storage == Storage::Interned ? m_interned.id : InternTable::no_id;
+}
+
+void NoThrowString::assign(const std::string_view string, MemoryPool* pool) noexcept
+{
+    const std::size_t size = std::min<std::size_t>(string.size(), std::numeric_limits<std::uint32_t>::max());
+
+    if (size > inline_capacity)
+    {
+        const std::size_t bytes = offsetof(SharedBlock, data) + size;
+        void* memory            = pool != nullptr ? pool->allocate_block(bytes) : ::operator new(bytes, std::nothrow);
+        if (memory != nullptr)
+        {
+            m_shared = ::new(memory) SharedBlock{{1}, pool != nullptr, {}};
+            std::memcpy(m_shared->data, string.data(), size);
+            m_size    = static_cast<std::uint32_t>(size);
+            m_storage = Storage::Shared;
+            return;
+        }
+    }
+
+    // Strings that fit inline never allocate, longer ones are cut short if the heap is exhausted.
+    m_size    = static_cast<std::uint32_t>(std::min(size, inline_capacity));
+    m_storage = Storage::Inline;
+    std::memcpy(m_inline, string.data(), m_size);
+}
+
+void NoThrowString::copy_from(const NoThrowString& string) noexcept
+{
+    m_size    = string.m_size;
+    m_storage = string.m_storage;
+
+    switch (m_storage)
+    {
+    case Storage::Static:
+        m_static = string.m_static;
+        break;
+    case Storage::Inline:
+        std::memcpy(m_inline, string.m_inline, m_size);
+        break;
+    case Storage::Shared:
+        m_shared = string.m_shared;
+        m_shared->references.fetch_add(1, std::memory_order_relaxed);
+        break;
+    case Storage::Interned:
+        m_interned = string.m_interned;
+        break;
+    }
+}
+
+void NoThrowString::steal_from(NoThrowString& string) noexcept
+{
+    if (string.m_storage != Storage::Shared)
+    {
+        copy_from(string);
+        return;
+    }
+
+    m_shared  = string.m_shared;
+    m_size    = string.m_size;
+    m_storage = Storage::Shared;
+
+    string.m_static  = s_default_string.data();
+    string.m_size    = static_cast<std::uint32_t>(s_default_string.size());
+    string.m_storage = Storage::Static;
+}
+
+void NoThrowString::reset() noexcept
+{
+    if (m_storage == Storage::Shared && m_shared->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        const bool pooled = m_shared->pooled;
+        m_shared->~SharedBlock();
+        if (pooled)
+            MemoryPool::deallocate_block(m_shared);
+        else
+            ::operator delete(m_shared);
+    }
+
+    m_static  = s_default_string.data();
+    m_size    = static_cast<std::uint32_t>(s_default_string.size());
+    m_storage = Storage::Static;
+}
 
-    return *m_str;
+namespace literals
+{
+NoThrowString operator""_nts(const char* string, const std::size_t size) noexcept
+{
+    return NoThrowString::from_static({string, size});
+}
 }
 } // vulren
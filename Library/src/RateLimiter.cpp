@@ -0,0 +1,216 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "RateLimiter.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <new>
+#include <string>
+
+#if defined(__linux__)
+#include <time.h>
+#endif
+
+namespace isc
+{
+RateLimiter::RateLimiter(Logger& sink) noexcept
+    : RateLimiter(sink, Options())
+{}
+
+RateLimiter::RateLimiter(Logger& sink, const Options& options) noexcept
+    : Logger(Message::Severity::Debug),
+      m_sink(sink),
+      m_options(options)
+{
+    // The token bucket is kept as a theoretical arrival time, which moves forward by one interval per message,
+    // and may run ahead of the clock by at most the burst.
+    m_interval  = static_cast<std::uint64_t>(1e9 / std::max(m_options.rate, 1e-3));
+    m_tolerance = m_interval * std::max<std::uint32_t>(m_options.burst, 1);
+
+    const std::size_t capacity = std::bit_ceil(std::max<std::size_t>(m_options.capacity, 2));
+    m_sites                    = new(std::nothrow) Site[capacity];
+    m_mask                     = m_sites != nullptr ? capacity - 1 : 0;
+
+    m_next_report.store(now() + static_cast<std::uint64_t>(std::chrono::nanoseconds(m_options.summary_interval).count()), std::memory_order_relaxed);
+}
+
+RateLimiter::~RateLimiter() noexcept
+{
+    report_suppressed();
+    delete[] m_sites;
+}
+
+bool RateLimiter::admit(const unsigned int code, const std::source_location& location) const noexcept
+{
+    Site* site = find_site(code, location);
+    if (site == nullptr)
+        return true;
+
+    bool admitted;
+    if (m_options.mode == Mode::Sample)
+        admitted = site->state.fetch_add(1, std::memory_order_relaxed) % std::max<std::uint32_t>(m_options.sample_every, 1) == 0;
+    else
+    {
+        const std::uint64_t time   = now();
+        std::uint64_t arrival      = site->state.load(std::memory_order_relaxed);
+        std::uint64_t next_arrival = std::max(arrival, time) + m_interval;
+
+        admitted = next_arrival - time <= m_tolerance;
+        while (admitted && !site->state.compare_exchange_weak(arrival, next_arrival, std::memory_order_relaxed))
+        {
+            next_arrival = std::max(arrival, time) + m_interval;
+            admitted     = next_arrival - time <= m_tolerance;
+        }
+    }
+
+    // Suppressed messages only look at the clock for a report every so often, they are meant to be as cheap as possible.
+    if (!admitted && site->suppressed.fetch_add(1, std::memory_order_relaxed) % 16 == 0)
+        maybe_report();
+
+    return admitted;
+}
+
+void RateLimiter::log_admitted(const Message& message) const noexcept
+{
+    m_sink.log_message(message);
+    maybe_report();
+}
+
+void RateLimiter::report_suppressed() const noexcept
+{
+    for (std::size_t i = 0; m_sites != nullptr && i <= m_mask; ++i)
+    {
+        Site& site = m_sites[i];
+        if (!site.ready.load(std::memory_order_acquire))
+            continue;
+
+        // Whoever moves reported up to suppressed owns the difference, so no repeat is reported twice.
+        const std::uint64_t suppressed = site.suppressed.load(std::memory_order_relaxed);
+        std::uint64_t reported         = site.reported.load(std::memory_order_relaxed);
+        do
+        {
+            if (reported >= suppressed)
+                break;
+        }
+        while (!site.reported.compare_exchange_weak(reported, suppressed, std::memory_order_relaxed));
+
+        if (reported >= suppressed)
+            continue;
+
+        try
+        {
+            m_sink.log_message(WarningMessage(
+                0,
+                "Messages Suppressed",
+                "Suppressed " + std::to_string(suppressed - reported) + " repeats of code " + std::to_string(site.code)
+                + " from " + site.file + ':' + std::to_string(site.line) + '.'
+            ));
+        }
+        catch (...)
+        {
+            // Reporting is best effort, the total is still available through suppressed().
+        }
+    }
+}
+
+std::uint64_t RateLimiter::suppressed() const noexcept
+{
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; m_sites != nullptr && i <= m_mask; ++i)
+        total += m_sites[i].suppressed.load(std::memory_order_relaxed);
+
+    return total;
+}
+
+void RateLimiter::log_message_internal(const Message& message) const noexcept
+{
+    if (admit(message.code(), message.location()))
+        log_admitted(message);
+}
+
+void RateLimiter::log_record_internal(const Record& record) const noexcept
+{
+    if (!admit(record.code(), record.location()))
+        return;
+
+    m_sink.log_record(record);
+    maybe_report();
+}
+
+RateLimiter::Site* RateLimiter::find_site(const unsigned int code, const std::source_location& location) const noexcept
+{
+    if (m_sites == nullptr)
+        return nullptr;
+
+    const char* file         = location.file_name();
+    const std::uint32_t line = location.line();
+
+    // File names of source locations are string literals, so their address tells the files apart.
+    std::uint64_t key = reinterpret_cast<std::uintptr_t>(file);
+    key               = (key ^ (static_cast<std::uint64_t>(line) << 32 | code)) * 0x9E3779B97F4A7C15ull;
+    key ^= key >> 29;
+    key = key != 0 ? key : 1;
+
+    // The key only narrows the search down, different sites can share one, so the site itself is compared as well.
+    for (std::size_t i = 0, index = key & m_mask; i <= m_mask; ++i, index = (index + 1) & m_mask)
+    {
+        Site& site             = m_sites[index];
+        std::uint64_t existing = site.key.load(std::memory_order_acquire);
+
+        if (existing == 0 && site.key.compare_exchange_strong(existing, key, std::memory_order_acq_rel))
+        {
+            site.code = code;
+            site.line = line;
+            site.file = file;
+            site.ready.store(true, std::memory_order_release);
+            return &site;
+        }
+
+        if (existing != key)
+            continue;
+
+        // Another thread is still filling the slot in, the message is let through rather than waiting for it.
+        if (!site.ready.load(std::memory_order_acquire))
+            return nullptr;
+
+        if (site.code == code && site.line == line && site.file == file)
+            return &site;
+    }
+
+    // Every slot is taken, so this call site is not limited.
+    return nullptr;
+}
+
+std::uint64_t RateLimiter::now() noexcept
+{
+#if defined(__linux__)
+    // The coarse clock ticks every few milliseconds, plenty for rates of a few hundred messages per second, and costs a
+    // fraction of a full clock read, which would otherwise dominate the cost of a suppressed message.
+    timespec time{};
+    if (clock_gettime(CLOCK_MONOTONIC_COARSE, &time) == 0)
+        return static_cast<std::uint64_t>(time.tv_sec) * 1'000'000'000ull + static_cast<std::uint64_t>(time.tv_nsec);
+#endif
+
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()
+    ).count());
+}
+
+void RateLimiter::maybe_report() const noexcept
+{
+    if (m_options.summary_interval.count() <= 0)
+        return;
+
+    // Only the thread that moves the deadline forward reports, everyone else carries on logging.
+    const std::uint64_t time = now();
+    std::uint64_t deadline   = m_next_report.load(std::memory_order_relaxed);
+    if (time < deadline)
+        return;
+
+    const auto interval = static_cast<std::uint64_t>(std::chrono::nanoseconds(m_options.summary_interval).count());
+    if (m_next_report.compare_exchange_strong(deadline, time + interval, std::memory_order_relaxed))
+        report_suppressed();
+}
+} // isc
@@ -0,0 +1,291 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "Record.hpp"
+
+#include "InternTable.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+namespace isc
+{
+Record::Record(const Message& message) noexcept
+    : Record(message, true)
+{}
+
+Record::Record(const Message& message, const bool spill) noexcept
+    : m_code(message.code()),
+      m_severity(message.severity()),
+      m_has_description(message.has_description()),
+      m_source_location(message.location()),
+      m_timestamp(message.timestamp()),
+      m_thread_id(current_thread_id())
+{
+    // Interned names are looked up from their id, so only names that are not interned take up room in the text.
+    m_name_id                      = message.name_id();
+    const std::string_view name    = m_name_id != util::InternTable::no_id ? std::string_view() : message.name();
+    const auto& frames             = message.get_trace();
+    const util::FormatArgs& format = message.format_args();
+
+    // A deferred description is stored as its encoded arguments, which are formatted by whoever writes the record.
+    std::string_view description;
+    if (!format.empty() && !format.is_rendered())
+    {
+        m_format      = format.format_string().data();
+        m_format_size = static_cast<std::uint32_t>(format.format_string().size());
+        description   = {reinterpret_cast<const char*>(format.arguments().data()), format.arguments().size()};
+    }
+    else if (m_has_description)
+        description = message.description();
+
+    // Fields are stored encoded after the name and description, and trace frames null terminated after the fields.
+    const std::span<const std::byte> fields = message.fields().encoded();
+    std::size_t required                    = name.size() + description.size() + fields.size();
+    for (const std::string_view frame : frames)
+        required += frame.size() + 1;
+
+    char* text           = m_inline;
+    std::size_t capacity = inline_capacity;
+    if (spill && required > inline_capacity && required <= std::numeric_limits<std::uint32_t>::max())
+    {
+        m_spill = static_cast<char*>(std::malloc(required));
+        if (m_spill != nullptr)
+        {
+            text     = m_spill;
+            capacity = required;
+        }
+    }
+
+    m_truncated = required > capacity;
+    if (m_truncated && m_format != nullptr && name.size() + description.size() > capacity)
+    {
+        // Arguments that are cut short cannot be decoded, so the description is formatted now instead.
+        m_format      = nullptr;
+        m_format_size = 0;
+        description   = message.description();
+    }
+
+    m_name_size = static_cast<std::uint32_t>(std::min(name.size(), capacity));
+    if (m_name_size > 0)
+        std::memcpy(text, name.data(), m_name_size);
+    std::size_t size = m_name_size;
+
+    m_description_size = static_cast<std::uint32_t>(std::min(description.size(), capacity - size));
+    if (m_description_size > 0)
+        std::memcpy(text + size, description.data(), m_description_size);
+    size += m_description_size;
+
+    if (!fields.empty() && fields.size() <= capacity - size)
+    {
+        std::memcpy(text + size, fields.data(), fields.size());
+        m_fields_size = static_cast<std::uint32_t>(fields.size());
+        size += m_fields_size;
+    }
+
+    for (const std::string_view frame : frames)
+    {
+        if (frame.size() + 1 > capacity - size || m_trace_size == std::numeric_limits<std::uint16_t>::max())
+            break;
+
+        if (!frame.empty())
+            std::memcpy(text + size, frame.data(), frame.size());
+        text[size + frame.size()] = '\0';
+        size += frame.size() + 1;
+        ++m_trace_size;
+    }
+
+    m_text_size = static_cast<std::uint32_t>(size);
+}
+
+Record Record::clone() const noexcept
+{
+    Record copy = *this;
+    if (m_spill == nullptr)
+        return copy;
+
+    copy.m_spill = static_cast<char*>(std::malloc(m_text_size));
+    if (copy.m_spill != nullptr)
+    {
+        std::memcpy(copy.m_spill, m_spill, m_text_size);
+        return copy;
+    }
+
+    return inline_copy();
+}
+
+Record Record::inline_copy() const noexcept
+{
+    Record copy = *this;
+    if (m_spill == nullptr)
+        return copy;
+
+    // Keep the name and description, the fields and trace frames are the first thing to go.
+    copy.m_spill            = nullptr;
+    copy.m_truncated        = true;
+    copy.m_trace_size       = 0;
+    copy.m_fields_size      = 0;
+    copy.m_name_size        = static_cast<std::uint32_t>(std::min<std::size_t>(m_name_size, inline_capacity));
+    copy.m_description_size = static_cast<std::uint32_t>(std::min<std::size_t>(m_description_size, inline_capacity - copy.m_name_size));
+    if (copy.m_description_size < m_description_size && m_format != nullptr)
+    {
+        // Arguments that are cut short cannot be decoded, so the description goes instead.
+        copy.m_format           = nullptr;
+        copy.m_format_size      = 0;
+        copy.m_has_description  = false;
+        copy.m_description_size = 0;
+    }
+    copy.m_text_size = copy.m_name_size + copy.m_description_size;
+    std::memcpy(copy.m_inline, m_spill, copy.m_name_size);
+    std::memcpy(copy.m_inline + copy.m_name_size, m_spill + m_name_size, copy.m_description_size);
+    return copy;
+}
+
+void Record::release() noexcept
+{
+    std::free(m_spill);
+    m_spill     = nullptr;
+    m_text_size = 0;
+    m_name_size = m_description_size = m_fields_size = 0;
+    m_trace_size = 0;
+}
+
+Message Record::to_message() const
+{
+    const util::NoThrowString message_name = m_name_id != util::InternTable::no_id
+                                                 ? util::NoThrowString::interned(name())
+                                                 : util::NoThrowString(name());
+
+    Message message = deferred()
+                          ? Message(m_code, message_name, util::FormatArgs::from_encoded(description(), arguments()), m_severity, m_source_location)
+                          : m_has_description
+                          ? Message(m_code, message_name, std::string(description()), m_severity, m_source_location)
+                          : Message(m_code, message_name, m_severity, m_source_location);
+
+    message.m_timestamp = m_timestamp;
+
+    for (const util::Field& field : fields())
+    {
+        switch (field.type)
+        {
+        case util::Field::Type::Bool:
+            message.add_field(field.key, field.boolean);
+            break;
+        case util::Field::Type::Int:
+            message.add_field(field.key, field.integer);
+            break;
+        case util::Field::Type::UInt:
+            message.add_field(field.key, field.unsigned_integer);
+            break;
+        case util::Field::Type::Double:
+            message.add_field(field.key, field.number);
+            break;
+        case util::Field::Type::String:
+            message.add_field(field.key, field.string);
+            break;
+        }
+    }
+
+    for (std::size_t i = 0; i < trace_size(); ++i)
+        message.add_trace(trace(i));
+
+    return message;
+}
+
+std::string Record::message() const
+{
+    std::string out;
+    format_to(out);
+    return out;
+}
+
+void Record::format_to(std::string& out) const
+{
+    out += '[';
+    out += Message::severity_name(m_severity);
+    out += "]: ";
+    out += name();
+    if (m_has_description)
+    {
+        out += " - ";
+        format_description_to(out);
+    }
+
+    util::Fields::format_to(fields(), out);
+}
+
+void Record::format_description_to(std::string& out) const
+{
+    if (!deferred())
+    {
+        out += description();
+        return;
+    }
+
+    const std::size_t size = out.size();
+    try
+    {
+        util::FormatArgs::render(description(), arguments(), out);
+    }
+    catch (const std::bad_alloc&)
+    {
+        throw;
+    }
+    catch (...)
+    {
+        out.resize(size);
+        out += description();
+    }
+}
+
+std::string_view Record::name() const noexcept
+{
+    if (m_name_id != util::InternTable::no_id)
+        return util::InternTable::global().lookup(m_name_id);
+
+    return {text(), m_name_size};
+}
+
+std::string_view Record::description() const noexcept
+{
+    if (deferred())
+        return {m_format, m_format_size};
+
+    return {text() + m_name_size, m_description_size};
+}
+
+util::Fields::View Record::fields() const noexcept
+{
+    return util::Fields::View({reinterpret_cast<const std::byte*>(text() + m_name_size + m_description_size), m_fields_size});
+}
+
+std::string_view Record::trace(const std::size_t index) const noexcept
+{
+    const char* frame = text() + m_name_size + m_description_size + m_fields_size;
+    for (std::size_t i = 0; i < index; ++i)
+        frame += std::strlen(frame) + 1;
+
+    return frame;
+}
+
+std::uint64_t Record::current_thread_id() noexcept
+{
+    static std::atomic<std::uint64_t> s_next_id = 1;
+    thread_local const std::uint64_t id         = s_next_id.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+std::span<const std::byte> Record::arguments() const noexcept
+{
+    return {reinterpret_cast<const std::byte*>(text() + m_name_size), m_description_size};
+}
+
+const char* Record::text() const noexcept
+{
+    return m_spill != nullptr ? m_spill : m_inline;
+}
+} // isc
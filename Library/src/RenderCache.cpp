@@ -0,0 +1,42 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "RenderCache.hpp"
+
+namespace isc
+{
+RenderCache::RenderCache(const Message& message) noexcept
+    : m_message(&message)
+{}
+
+RenderCache::RenderCache(const Record& record) noexcept
+    : m_record(&record)
+{}
+
+std::string_view RenderCache::text() const noexcept
+{
+    if (m_rendered)
+        return m_text;
+
+    m_rendered = true;
+    try
+    {
+        if (m_message != nullptr)
+            m_message->format_to(m_text);
+        else
+            m_record->format_to(m_text);
+    }
+    catch (...)
+    {
+        m_text.clear();
+    }
+
+    return m_text;
+}
+
+bool RenderCache::rendered() const noexcept
+{
+    return m_rendered;
+}
+} // isc
@@ -0,0 +1,259 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "SignalWriter.hpp"
+
+#include "Record.hpp"
+#include "TimestampFormatter.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace isc::util
+{
+namespace
+{
+const TimestampFormatter s_timestamps;
+} // namespace
+
+SignalWriter::SignalWriter(const int fd, const std::span<char> buffer) noexcept
+    : m_fd(fd),
+      m_buffer(buffer)
+{}
+
+SignalWriter::~SignalWriter() noexcept
+{
+    flush();
+}
+
+void SignalWriter::write(std::string_view string) noexcept
+{
+    while (!string.empty())
+    {
+        if (m_size == m_buffer.size())
+        {
+            flush();
+            if (m_buffer.empty())
+            {
+                write_all(m_fd, string.data(), string.size());
+                return;
+            }
+        }
+
+        const std::size_t count = std::min(string.size(), m_buffer.size() - m_size);
+        std::memcpy(m_buffer.data() + m_size, string.data(), count);
+        m_size += count;
+        string.remove_prefix(count);
+    }
+}
+
+void SignalWriter::write(const char character) noexcept
+{
+    write(std::string_view(&character, 1));
+}
+
+void SignalWriter::write_unsigned(std::uint64_t number) noexcept
+{
+    char digits[20];
+    std::size_t first = sizeof(digits);
+    do
+    {
+        digits[--first] = static_cast<char>('0' + number % 10);
+        number /= 10;
+    }
+    while (number > 0);
+
+    write(std::string_view(digits + first, sizeof(digits) - first));
+}
+
+void SignalWriter::write_signed(const std::int64_t number) noexcept
+{
+    if (number >= 0)
+    {
+        write_unsigned(static_cast<std::uint64_t>(number));
+        return;
+    }
+
+    write('-');
+    write_unsigned(0 - static_cast<std::uint64_t>(number));
+}
+
+void SignalWriter::write_hex(std::uint64_t number) noexcept
+{
+    constexpr char s_digits[] = "0123456789abcdef";
+
+    char digits[18];
+    std::size_t first = sizeof(digits);
+    do
+    {
+        digits[--first] = s_digits[number & 0xF];
+        number >>= 4;
+    }
+    while (number > 0);
+
+    digits[--first] = 'x';
+    digits[--first] = '0';
+    write(std::string_view(digits + first, sizeof(digits) - first));
+}
+
+void SignalWriter::write_double(double number) noexcept
+{
+    if (std::isnan(number))
+    {
+        write("nan");
+        return;
+    }
+
+    if (std::signbit(number))
+    {
+        write('-');
+        number = -number;
+    }
+
+    if (std::isinf(number))
+    {
+        write("inf");
+        return;
+    }
+
+    // Numbers whose integer part fits are written in fixed point, the rest are scaled into [1, 10) first.
+    int exponent = 0;
+    if (number >= 1e15 || (number != 0.0 && number < 1e-4))
+    {
+        while (number >= 10.0)
+        {
+            number /= 10.0;
+            ++exponent;
+        }
+        while (number < 1.0)
+        {
+            number *= 10.0;
+            --exponent;
+        }
+    }
+
+    auto integer  = static_cast<std::uint64_t>(number);
+    auto fraction = static_cast<std::uint64_t>(std::llround((number - static_cast<double>(integer)) * 1e6));
+    if (fraction >= 1'000'000)
+    {
+        ++integer;
+        fraction -= 1'000'000;
+    }
+
+    write_unsigned(integer);
+    write('.');
+
+    char digits[6];
+    for (std::size_t i = sizeof(digits); i > 0; --i)
+    {
+        digits[i - 1] = static_cast<char>('0' + fraction % 10);
+        fraction /= 10;
+    }
+    write(std::string_view(digits, sizeof(digits)));
+
+    if (exponent != 0)
+    {
+        write('e');
+        write_signed(exponent);
+    }
+}
+
+void SignalWriter::write_record(const Record& record) noexcept
+{
+    char timestamp[TimestampFormatter::max_size];
+    write(std::string_view(timestamp, s_timestamps.format_uncached(record.timestamp(), timestamp)));
+    write(" thread=");
+    write_unsigned(record.thread_id());
+
+    write(" [");
+    write(Message::severity_name(record.severity()));
+    write("]: ");
+    write(record.name());
+    if (record.has_description())
+    {
+        write(" - ");
+        write(record.description());
+    }
+
+    for (const Field& field : record.fields())
+    {
+        write(' ');
+        write(field.key);
+        write('=');
+        switch (field.type)
+        {
+        case Field::Type::Bool:
+            write(field.boolean ? "true" : "false");
+            break;
+        case Field::Type::Int:
+            write_signed(field.integer);
+            break;
+        case Field::Type::UInt:
+            write_unsigned(field.unsigned_integer);
+            break;
+        case Field::Type::Double:
+            write_double(field.number);
+            break;
+        case Field::Type::String:
+            write('"');
+            write(field.string);
+            write('"');
+            break;
+        }
+    }
+    write('\n');
+
+    for (std::size_t i = 0; i < record.trace_size(); ++i)
+    {
+        write("    at ");
+        write(record.trace(i));
+        write('\n');
+    }
+}
+
+void SignalWriter::flush() noexcept
+{
+    if (m_size == 0)
+        return;
+
+    write_all(m_fd, m_buffer.data(), m_size);
+    m_size = 0;
+}
+
+int SignalWriter::fd() const noexcept
+{
+    return m_fd;
+}
+
+bool SignalWriter::write_all(const int fd, const void* data, std::size_t size) noexcept
+{
+    const auto* bytes = static_cast<const char*>(data);
+    while (size > 0)
+    {
+#if defined(_WIN32)
+        const int written = ::_write(fd, bytes, static_cast<unsigned int>(std::min<std::size_t>(size, 1u << 30)));
+#else
+        const ssize_t written = ::write(fd, bytes, size);
+#endif
+        if (written < 0 && errno == EINTR)
+            continue;
+
+        if (written <= 0)
+            return false;
+
+        bytes += written;
+        size -= static_cast<std::size_t>(written);
+    }
+
+    return true;
+}
+} // isc::util
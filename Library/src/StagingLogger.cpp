@@ -0,0 +1,285 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "StagingLogger.hpp"
+
+#include "CrashHandler.hpp"
+#include "SignalWriter.hpp"
+
+#include <algorithm>
+
+namespace isc
+{
+StagingLogger::ThreadBuffer::ThreadBuffer(const std::size_t capacity) noexcept
+    : records(capacity)
+{}
+
+StagingLogger::StagingLogger(Logger& sink) noexcept
+    : StagingLogger(sink, Options())
+{}
+
+StagingLogger::StagingLogger(Logger& sink, const Options& options) noexcept
+    : Logger(Message::Severity::Debug),
+      m_sink(sink),
+      m_options(options)
+{
+    CrashHandler::watch(*this);
+
+    try
+    {
+        m_flusher = std::thread(&StagingLogger::run, this);
+    }
+    catch (...)
+    {
+        // Without a flusher every message is logged synchronously, see log_message_internal.
+    }
+}
+
+StagingLogger::~StagingLogger() noexcept
+{
+    CrashHandler::unwatch(*this);
+    shutdown();
+}
+
+void StagingLogger::flush() noexcept
+{
+    wait_for_flush();
+}
+
+void StagingLogger::wait_for_flush() const noexcept
+{
+    if (!m_flusher.joinable() || m_stopped.load(std::memory_order_acquire))
+        return;
+
+    const std::uint64_t target = m_requested.fetch_add(1, std::memory_order_acq_rel) + 1;
+    request_flush();
+
+    std::uint64_t served = m_served.load(std::memory_order_acquire);
+    while (served < target && !m_stopped.load(std::memory_order_acquire))
+    {
+        m_served.wait(served, std::memory_order_acquire);
+        served = m_served.load(std::memory_order_acquire);
+    }
+}
+
+void StagingLogger::shutdown() noexcept
+{
+    if (!m_flusher.joinable())
+        return;
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_one();
+    m_flusher.join();
+
+    // Threads racing with the shutdown may have staged messages after the flusher's last pass.
+    flush_buffers();
+}
+
+void StagingLogger::log_message_internal(const Message& message) const noexcept
+{
+    if (!m_flusher.joinable() || m_stopped.load(std::memory_order_acquire))
+    {
+        // Without a flusher, other threads logging directly and the final flush_buffers still share the sink.
+        std::lock_guard lock(m_sink_mutex);
+        m_sink.log_message(message);
+        return;
+    }
+
+    stage(Record(message));
+}
+
+void StagingLogger::log_record_internal(const Record& record) const noexcept
+{
+    if (!m_flusher.joinable() || m_stopped.load(std::memory_order_acquire))
+    {
+        std::lock_guard lock(m_sink_mutex);
+        m_sink.log_record(record);
+        return;
+    }
+
+    // The caller keeps ownership of its record, so the staged copy needs its own spill storage.
+    stage(record.clone());
+}
+
+void StagingLogger::dump_pending_internal(util::SignalWriter& writer) const noexcept
+{
+    // If the crashed thread holds the lock, the staged records are lost rather than risking a deadlock.
+    // Records are not released, freeing is not async-signal-safe and the process is about to end anyway.
+    if (!m_buffers.mutex().try_lock())
+        return;
+
+    Record record;
+    for (const std::shared_ptr<ThreadBuffer>& buffer : m_buffers.slots())
+    {
+        while (buffer->records.try_pop(record))
+            writer.write_record(record);
+    }
+
+    m_buffers.mutex().unlock();
+}
+
+StagingLogger::ThreadBuffer* StagingLogger::local_buffer() const noexcept
+{
+    // The buffer is shared with the logger so that either can go away first, and is taken over with whatever it still holds.
+    return m_buffers.local([this] {
+        auto buffer = std::make_shared<ThreadBuffer>(m_options.buffer_capacity);
+        return buffer->records.valid() ? buffer : nullptr;
+    });
+}
+
+void StagingLogger::stage(Record record) const noexcept
+{
+    ThreadBuffer* buffer = local_buffer();
+    if (buffer == nullptr)
+    {
+        // There is no buffer to stage in, so the message has to take turns with the flusher instead.
+        std::lock_guard lock(m_sink_mutex);
+        m_sink.log_record(record);
+        record.release();
+        return;
+    }
+
+    const Message::Severity severity = record.severity();
+    while (!buffer->records.try_push(record))
+    {
+        // The buffer is full, so this thread waits for the flusher to make room, like a full queue would.
+        const std::uint64_t passes = m_passes.load(std::memory_order_acquire);
+        if (m_stopped.load(std::memory_order_acquire))
+        {
+            std::lock_guard lock(m_sink_mutex);
+            m_sink.log_record(record);
+            record.release();
+            return;
+        }
+
+        request_flush();
+        m_passes.wait(passes, std::memory_order_acquire);
+    }
+
+    // Waking the flusher once the buffer is half full keeps busy threads from ever finding it full.
+    const bool half_full = ++buffer->staged_since_wake >= m_options.buffer_capacity / 2;
+    if (half_full || severity >= m_options.flush_severity)
+        buffer->staged_since_wake = 0;
+
+    if (severity == Message::Severity::Fatal)
+        wait_for_flush();
+    else if (half_full || severity >= m_options.flush_severity)
+        request_flush();
+}
+
+void StagingLogger::request_flush() const noexcept
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_flush_requested = true;
+    }
+    m_wake.notify_one();
+}
+
+void StagingLogger::run() noexcept
+{
+    try
+    {
+        m_snapshot.reserve(64);
+        m_batch.reserve(m_options.buffer_capacity);
+        m_order.reserve(m_options.buffer_capacity);
+    }
+    catch (...)
+    {}
+
+    bool stopping = false;
+    while (!stopping)
+    {
+        {
+            std::unique_lock lock(m_mutex);
+            m_wake.wait_for(lock, m_options.flush_interval, [this] { return m_flush_requested || m_stopping; });
+            m_flush_requested = false;
+            stopping          = m_stopping;
+        }
+
+        if (stopping)
+            m_stopped.store(true, std::memory_order_release);
+
+        const std::uint64_t serving = m_requested.load(std::memory_order_acquire);
+        flush_buffers();
+
+        m_served.store(serving, std::memory_order_release);
+        m_served.notify_all();
+        m_passes.fetch_add(1, std::memory_order_release);
+        m_passes.notify_all();
+    }
+}
+
+void StagingLogger::flush_buffers() noexcept
+{
+    {
+        std::lock_guard lock(m_buffers.mutex());
+
+        // Buffers of threads that have exited are dropped once there is nothing left in them, unless taken over first.
+        std::erase_if(m_buffers.slots(), [](const std::shared_ptr<ThreadBuffer>& buffer) {
+            return buffer->abandoned() && buffer->records.empty();
+        });
+
+        m_snapshot.clear();
+        for (const std::shared_ptr<ThreadBuffer>& buffer : m_buffers.slots())
+        {
+            try
+            {
+                m_snapshot.push_back(buffer.get());
+            }
+            catch (...)
+            {
+                break;
+            }
+        }
+    }
+
+    // Each buffer is drained up to what it held when the pass started, so a busy thread cannot keep the pass going.
+    m_batch.clear();
+    for (ThreadBuffer* buffer : m_snapshot)
+    {
+        Record record;
+        for (std::size_t i = 0; i < m_options.buffer_capacity && buffer->records.try_pop(record); ++i)
+        {
+            try
+            {
+                m_batch.push_back(record);
+            }
+            catch (...)
+            {
+                std::lock_guard lock(m_sink_mutex);
+                m_sink.log_record(record);
+                record.release();
+            }
+        }
+    }
+
+    // Records are large, so their timestamps are sorted instead. Ties keep the order the records were popped in,
+    // which keeps every thread's records in the order they were logged.
+    bool sorted = true;
+    try
+    {
+        m_order.clear();
+        for (std::size_t i = 0; i < m_batch.size(); ++i)
+            m_order.emplace_back(m_batch[i].timestamp(), static_cast<std::uint32_t>(i));
+        std::sort(m_order.begin(), m_order.end());
+    }
+    catch (...)
+    {
+        sorted = false;
+    }
+
+    std::lock_guard lock(m_sink_mutex);
+    for (std::size_t i = 0; i < m_batch.size(); ++i)
+    {
+        Record& record = m_batch[sorted ? m_order[i].second : i];
+        m_sink.log_record(record);
+        record.release();
+    }
+    m_batch.clear();
+}
+} // isc
@@ -0,0 +1,112 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "TimestampFormatter.hpp"
+
+#include <cstring>
+#include <limits>
+
+namespace isc::util
+{
+namespace
+{
+constexpr std::size_t s_prefix_size = 17; // "YYYY-MM-DDTHH:MM:"
+
+struct PrefixCache
+{
+    std::uint64_t minute       = std::numeric_limits<std::uint64_t>::max();
+    char prefix[s_prefix_size] = {};
+};
+
+thread_local PrefixCache t_cache;
+
+void write_digits(char* out, std::uint64_t value, const std::size_t count) noexcept
+{
+    for (std::size_t i = count; i > 0; --i)
+    {
+        out[i - 1] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+}
+
+// Renders "YYYY-MM-DDTHH:MM:" for a minute since the epoch, converting days to a civil date without going through the C library.
+void render_prefix(const std::uint64_t minute, char* out) noexcept
+{
+    const std::uint64_t days     = minute / (24 * 60);
+    const std::uint64_t of_day   = minute % (24 * 60);
+    const std::uint64_t shifted  = days + 719468;
+    const std::uint64_t era      = shifted / 146097;
+    const std::uint64_t of_era   = shifted - era * 146097;
+    const std::uint64_t year     = (of_era - of_era / 1460 + of_era / 36524 - of_era / 146096) / 365;
+    const std::uint64_t of_year  = of_era - (365 * year + year / 4 - year / 100);
+    const std::uint64_t march    = (5 * of_year + 2) / 153;
+    const std::uint64_t day      = of_year - (153 * march + 2) / 5 + 1;
+    const std::uint64_t month    = march < 10 ? march + 3 : march - 9;
+    const std::uint64_t calendar = year + era * 400 + (month <= 2 ? 1 : 0);
+
+    write_digits(out, calendar, 4);
+    out[4] = '-';
+    write_digits(out + 5, month, 2);
+    out[7] = '-';
+    write_digits(out + 8, day, 2);
+    out[10] = 'T';
+    write_digits(out + 11, of_day / 60, 2);
+    out[13] = ':';
+    write_digits(out + 14, of_day % 60, 2);
+    out[16] = ':';
+}
+} // namespace
+
+TimestampFormatter::TimestampFormatter(const Precision precision) noexcept
+    : m_precision(precision)
+{}
+
+std::size_t TimestampFormatter::format(const std::uint64_t timestamp, char* out) const noexcept
+{
+    const std::uint64_t minute = timestamp / 1'000'000'000 / 60;
+
+    PrefixCache& cache = t_cache;
+    if (cache.minute != minute)
+    {
+        render_prefix(minute, cache.prefix);
+        cache.minute = minute;
+    }
+
+    std::memcpy(out, cache.prefix, s_prefix_size);
+    return s_prefix_size + format_seconds(timestamp, out + s_prefix_size);
+}
+
+std::size_t TimestampFormatter::format_uncached(const std::uint64_t timestamp, char* out) const noexcept
+{
+    render_prefix(timestamp / 1'000'000'000 / 60, out);
+    return s_prefix_size + format_seconds(timestamp, out + s_prefix_size);
+}
+
+std::size_t TimestampFormatter::format_seconds(const std::uint64_t timestamp, char* out) const noexcept
+{
+    write_digits(out, timestamp / 1'000'000'000 % 60, 2);
+    std::size_t size = 2;
+
+    const auto digits = static_cast<std::size_t>(m_precision);
+    if (digits > 0)
+    {
+        std::uint64_t fraction = timestamp % 1'000'000'000;
+        for (std::size_t i = digits; i < 9; ++i)
+            fraction /= 10;
+
+        out[size++] = '.';
+        write_digits(out + size, fraction, digits);
+        size += digits;
+    }
+
+    out[size++] = 'Z';
+    return size;
+}
+
+void TimestampFormatter::append(const std::uint64_t timestamp, std::string& out) const
+{
+    char buffer[max_size];
+    out.append(buffer, format(timestamp, buffer));
+}
+} // isc::util
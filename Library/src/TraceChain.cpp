@@ -0,0 +1,189 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "TraceChain.hpp"
+
+#include "MemoryPool.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <utility>
+
+namespace isc::util
+{
+// Each frame is stored as its size followed by its characters.
+using FrameSize = std::uint32_t;
+
+TraceChain::Iterator::Iterator(const char* position) noexcept
+    : m_position(position)
+{}
+
+std::string_view TraceChain::Iterator::operator*() const noexcept
+{
+    FrameSize size;
+    std::memcpy(&size, m_position, sizeof(size));
+    return {m_position + sizeof(size), size};
+}
+
+TraceChain::Iterator& TraceChain::Iterator::operator++() noexcept
+{
+    FrameSize size;
+    std::memcpy(&size, m_position, sizeof(size));
+    m_position += sizeof(size) + size;
+    return *this;
+}
+
+TraceChain::Iterator TraceChain::Iterator::operator++(int) noexcept
+{
+    const Iterator previous = *this;
+    ++*this;
+    return previous;
+}
+
+TraceChain::TraceChain(MemoryPool& pool) noexcept
+    : m_pool(&pool)
+{}
+
+TraceChain::~TraceChain() noexcept
+{
+    release();
+}
+
+TraceChain::TraceChain(const TraceChain& chain) noexcept
+    : m_block(chain.m_block),
+      m_size(chain.m_size),
+      m_used(chain.m_used),
+      m_pool(chain.m_pool)
+{
+    if (m_block != nullptr)
+        m_block->references.fetch_add(1, std::memory_order_relaxed);
+}
+
+TraceChain& TraceChain::operator=(const TraceChain& chain) noexcept
+{
+    if (&chain == this)
+        return *this;
+
+    if (chain.m_block != nullptr)
+        chain.m_block->references.fetch_add(1, std::memory_order_relaxed);
+
+    release();
+    m_block = chain.m_block;
+    m_size  = chain.m_size;
+    m_used  = chain.m_used;
+    m_pool  = chain.m_pool;
+
+    return *this;
+}
+
+TraceChain::TraceChain(TraceChain&& chain) noexcept
+    : m_block(std::exchange(chain.m_block, nullptr)),
+      m_size(std::exchange(chain.m_size, 0)),
+      m_used(std::exchange(chain.m_used, 0)),
+      m_pool(chain.m_pool)
+{}
+
+TraceChain& TraceChain::operator=(TraceChain&& chain) noexcept
+{
+    if (&chain == this)
+        return *this;
+
+    release();
+    m_block = std::exchange(chain.m_block, nullptr);
+    m_size  = std::exchange(chain.m_size, 0);
+    m_used  = std::exchange(chain.m_used, 0);
+    m_pool  = chain.m_pool;
+
+    return *this;
+}
+
+void TraceChain::append(const std::string_view frame) noexcept
+{
+    if (frame.size() > std::numeric_limits<FrameSize>::max() || m_size == std::numeric_limits<std::uint32_t>::max())
+        return;
+
+    const std::size_t required = m_used + sizeof(FrameSize) + frame.size();
+
+    // Only the chain whose frames end where the block's do may claim the room after them, the others keep their view.
+    std::size_t expected = m_used;
+    const bool in_place  = m_block != nullptr && required <= m_block->capacity
+                           && m_block->used.compare_exchange_strong(expected, required, std::memory_order_relaxed);
+
+    if (!in_place)
+    {
+        const std::size_t capacity = std::max({required, s_min_capacity, m_block != nullptr ? m_block->capacity * 2 : 0});
+        Block* block               = allocate(capacity, m_pool);
+        if (block == nullptr)
+            return;
+
+        const std::uint32_t frames = m_size;
+        const std::size_t used     = m_used;
+        if (used > 0)
+            std::memcpy(block->data, m_block->data, used);
+        block->used.store(required, std::memory_order_relaxed);
+
+        release();
+        m_block = block;
+        m_size  = frames;
+        m_used  = used;
+    }
+
+    const auto size = static_cast<FrameSize>(frame.size());
+    std::memcpy(m_block->data + m_used, &size, sizeof(size));
+    if (size > 0)
+        std::memcpy(m_block->data + m_used + sizeof(size), frame.data(), size);
+
+    m_used = required;
+    ++m_size;
+}
+
+std::size_t TraceChain::size() const noexcept
+{
+    return m_size;
+}
+
+bool TraceChain::empty() const noexcept
+{
+    return m_size == 0;
+}
+
+TraceChain::Iterator TraceChain::begin() const noexcept
+{
+    return Iterator(m_block != nullptr ? m_block->data : nullptr);
+}
+
+TraceChain::Iterator TraceChain::end() const noexcept
+{
+    return Iterator(m_block != nullptr ? m_block->data + m_used : nullptr);
+}
+
+TraceChain::Block* TraceChain::allocate(const std::size_t capacity, MemoryPool* pool) noexcept
+{
+    const std::size_t bytes = offsetof(Block, data) + capacity;
+    void* memory            = pool != nullptr ? pool->allocate_block(bytes) : ::operator new(bytes, std::nothrow);
+    if (memory == nullptr)
+        return nullptr;
+
+    return ::new(memory) Block{{1}, {0}, capacity, pool != nullptr, {}};
+}
+
+void TraceChain::release() noexcept
+{
+    if (m_block != nullptr && m_block->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        const bool pooled = m_block->pooled;
+        m_block->~Block();
+        if (pooled)
+            MemoryPool::deallocate_block(m_block);
+        else
+            ::operator delete(m_block);
+    }
+
+    m_block = nullptr;
+    m_size  = 0;
+    m_used  = 0;
+}
+} // isc::util
@@ -0,0 +1,161 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ISCLogs/ISCLogs.hpp>
+
+namespace
+{
+int s_failures = 0;
+
+void check(const bool condition, const char* what)
+{
+    if (condition)
+        return;
+
+    std::fprintf(stderr, "FAILED: %s\n", what);
+    ++s_failures;
+}
+
+/**
+ * A sink that takes its time with every message, remembers them, and notices being called from two threads at once.
+ */
+class SlowSink
+        : public isc::Logger
+{
+public:
+    struct Entry
+    {
+        unsigned int code;
+        isc::Message::Severity severity;
+    };
+
+    explicit SlowSink(const std::chrono::microseconds delay)
+        : Logger(isc::Message::Severity::Debug),
+          m_delay(delay)
+    {}
+
+    [[nodiscard]] std::vector<Entry> entries() const
+    {
+        std::lock_guard lock(m_mutex);
+        return m_entries;
+    }
+
+    [[nodiscard]] bool overlapped() const noexcept
+    {
+        return m_overlapped.load();
+    }
+
+protected:
+    void log_message_internal(const isc::Message& message) const noexcept override
+    {
+        if (m_busy.exchange(true))
+            m_overlapped.store(true);
+
+        std::this_thread::sleep_for(m_delay);
+
+        try
+        {
+            std::lock_guard lock(m_mutex);
+            m_entries.push_back({message.code(), message.severity()});
+        }
+        catch (...)
+        {}
+
+        m_busy.store(false);
+    }
+
+private:
+    std::chrono::microseconds m_delay;
+    mutable std::atomic<bool> m_busy       = false;
+    mutable std::atomic<bool> m_overlapped = false;
+    mutable std::mutex m_mutex;
+    mutable std::vector<Entry> m_entries;
+};
+
+void test_drop_oldest_keeps_fatal()
+{
+    SlowSink sink(std::chrono::milliseconds(2));
+    std::uint64_t dropped = 0;
+    {
+        isc::AsyncLogger logger(sink, 2, isc::AsyncLogger::OverflowPolicy::DropOldest);
+        logger.log_message(isc::FatalMessage(0, "Fatal"));
+        for (unsigned int code = 1; code <= 8; ++code)
+            logger.log_message(isc::DebugMessage(code, "Debug"));
+
+        logger.flush();
+        dropped = logger.dropped();
+    }
+
+    std::size_t fatal = 0;
+    const std::vector<SlowSink::Entry> entries = sink.entries();
+    for (const SlowSink::Entry& entry : entries)
+        fatal += entry.severity == isc::Message::Severity::Fatal;
+
+    check(dropped > 0, "the queue overflows");
+    check(fatal == 1, "a queued fatal message is never dropped to make room");
+    // The report of the dropped messages is logged on top of the messages that made it.
+    check(entries.size() == 9 - dropped + 1, "every message is either logged or counted as dropped");
+    check(!sink.overlapped(), "the sink is never called from two threads at once");
+}
+
+void test_shutdown_while_logging()
+{
+    constexpr unsigned int threads  = 4;
+    constexpr unsigned int messages = 200;
+
+    SlowSink sink(std::chrono::microseconds(20));
+    {
+        isc::AsyncLogger logger(sink, 8, isc::AsyncLogger::OverflowPolicy::Block);
+
+        std::vector<std::thread> producers;
+        for (unsigned int thread = 0; thread < threads; ++thread)
+        {
+            producers.emplace_back([&logger, thread] {
+                for (unsigned int i = 0; i < messages; ++i)
+                    logger.log_message(isc::DebugMessage(thread * messages + i, "Debug"));
+            });
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        logger.shutdown();
+
+        for (std::thread& producer : producers)
+            producer.join();
+    }
+
+    const std::vector<SlowSink::Entry> entries = sink.entries();
+    check(entries.size() == threads * messages, "messages logged while shutting down are not lost");
+
+    std::vector<unsigned int> next(threads, 0);
+    bool ordered = true;
+    for (const SlowSink::Entry& entry : entries)
+    {
+        const unsigned int thread = entry.code / messages;
+        ordered                   = ordered && entry.code % messages == next[thread]++;
+    }
+
+    check(ordered, "messages logged while shutting down stay in order");
+    check(!sink.overlapped(), "the sink is never called from two threads at once while shutting down");
+}
+}
+
+int main()
+{
+    test_drop_oldest_keeps_fatal();
+    test_shutdown_while_logging();
+
+    if (s_failures > 0)
+        return EXIT_FAILURE;
+
+    std::puts("All asynchronous logger tests passed.");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,263 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ISCLogs/ISCLogs.hpp>
+
+namespace
+{
+int s_failures = 0;
+
+void check(const bool condition, const char* what)
+{
+    if (condition)
+        return;
+
+    std::fprintf(stderr, "FAILED: %s\n", what);
+    ++s_failures;
+}
+
+/**
+ * A single-threaded event loop standing in for a service's executor. Coroutines are posted to it from any thread,
+ * e.g. the worker of an AsyncLogger, and resumed one at a time on the thread running the loop.
+ */
+class EventLoop
+        : public isc::Executor
+{
+public:
+    void post(const std::coroutine_handle<> coroutine) noexcept override
+    {
+        std::lock_guard lock(m_mutex);
+        m_ready.push_back(coroutine);
+        m_wake.notify_one();
+    }
+
+    void spawned() noexcept
+    {
+        std::lock_guard lock(m_mutex);
+        ++m_live;
+    }
+
+    void finished() noexcept
+    {
+        std::lock_guard lock(m_mutex);
+        --m_live;
+        m_wake.notify_one();
+    }
+
+    /**
+     * Resumes posted coroutines until every spawned task has finished.
+     */
+    void run()
+    {
+        const isc::Executor::Scope scope(*this);
+        while (true)
+        {
+            std::unique_lock lock(m_mutex);
+            m_wake.wait(lock, [this] { return !m_ready.empty() || m_live == 0; });
+            if (m_ready.empty())
+                return;
+
+            const std::coroutine_handle<> coroutine = m_ready.front();
+            m_ready.pop_front();
+            lock.unlock();
+            coroutine.resume();
+        }
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::deque<std::coroutine_handle<>> m_ready;
+    int m_live = 0;
+};
+
+/**
+ * A fire-and-forget task, which starts running as soon as it is called.
+ */
+struct Task
+{
+    struct promise_type
+    {
+        Task get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
+
+/**
+ * A sink slow enough that a small queue fills up, which remembers what it logged.
+ */
+class SlowSink
+        : public isc::Logger
+{
+public:
+    SlowSink()
+        : Logger(isc::Message::Severity::Debug)
+    {}
+
+    struct Entry
+    {
+        unsigned int code;
+        std::vector<std::string> trace;
+    };
+
+    [[nodiscard]] std::vector<Entry> entries() const
+    {
+        std::lock_guard lock(m_mutex);
+        return m_entries;
+    }
+
+protected:
+    void log_message_internal(const isc::Message& message) const noexcept override
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+
+        try
+        {
+            Entry entry{message.code(), {}};
+            for (const std::string_view frame : message.get_trace())
+                entry.trace.emplace_back(frame);
+
+            std::lock_guard lock(m_mutex);
+            m_entries.push_back(std::move(entry));
+        }
+        catch (...)
+        {}
+    }
+
+private:
+    mutable std::mutex m_mutex;
+    mutable std::vector<Entry> m_entries;
+};
+
+constexpr int s_tasks            = 8;
+constexpr int s_messages_per_task = 100;
+
+Task log_from_loop(EventLoop& loop, isc::AsyncLogger& logger, const int task, isc::TraceContext trace, std::atomic<int>& flushed)
+{
+    loop.spawned();
+    const auto frame = trace.enter("task " + std::to_string(task));
+
+    for (int i = 0; i < s_messages_per_task; ++i)
+    {
+        const auto code = static_cast<unsigned int>(task * s_messages_per_task + i);
+        co_await isc::co_log(logger, isc::NoticeMessage(code, "Message"), trace);
+    }
+
+    co_await isc::co_flush(logger);
+    flushed.fetch_add(1);
+    loop.finished();
+}
+
+Task log_without_executor(isc::AsyncLogger& logger, const unsigned int first, const int count, std::atomic<int>& finished)
+{
+    for (int i = 0; i < count; ++i)
+        co_await isc::co_log(logger, isc::NoticeMessage(first + static_cast<unsigned int>(i), "Message"));
+
+    co_await isc::co_flush(logger);
+    finished.fetch_add(1);
+}
+
+// Tasks on one event loop share a queue of two slots, so nearly every co_log has to suspend until the worker makes room.
+void test_backpressure_and_trace()
+{
+    SlowSink sink;
+    std::atomic<int> flushed = 0;
+    {
+        isc::AsyncLogger logger(sink, 2, isc::AsyncLogger::OverflowPolicy::Block);
+        EventLoop loop;
+        isc::TraceContext trace;
+        const auto frame = trace.enter("service");
+
+        {
+            const isc::Executor::Scope scope(loop);
+            for (int task = 0; task < s_tasks; ++task)
+                log_from_loop(loop, logger, task, trace, flushed);
+        }
+        loop.run();
+
+        // Every task flushed before finishing, so everything it logged has reached the sink already.
+        check(sink.entries().size() == s_tasks * s_messages_per_task, "every message is logged before co_flush resumes");
+    }
+
+    const std::vector<SlowSink::Entry> entries = sink.entries();
+    check(flushed.load() == s_tasks, "every task resumes after co_flush");
+    check(entries.size() == s_tasks * s_messages_per_task, "no message is dropped under backpressure");
+
+    std::vector<int> next(s_tasks, 0);
+    bool ordered = true;
+    bool traced  = true;
+    for (const SlowSink::Entry& entry : entries)
+    {
+        const int task = static_cast<int>(entry.code) / s_messages_per_task;
+        ordered        = ordered && static_cast<int>(entry.code) % s_messages_per_task == next[task]++;
+        traced         = traced && entry.trace.size() == 2 && entry.trace[0] == "task " + std::to_string(task) && entry.trace[1] == "service";
+    }
+    check(ordered, "each task's messages are logged in order");
+    check(traced, "trace frames carry over co_await, innermost first");
+}
+
+// Without an executor, suspended coroutines resume on the worker thread.
+void test_no_executor()
+{
+    SlowSink sink;
+    std::atomic<int> finished = 0;
+    isc::AsyncLogger logger(sink, 2, isc::AsyncLogger::OverflowPolicy::Block);
+
+    log_without_executor(logger, 0, 50, finished);
+    log_without_executor(logger, 1000, 50, finished);
+    while (finished.load() < 2)
+        std::this_thread::yield();
+
+    check(sink.entries().size() == 100, "coroutines without an executor log every message");
+}
+
+// Destroying the logger while a coroutine waits for room logs its message and resumes it.
+void test_shutdown_with_waiters()
+{
+    SlowSink sink;
+    std::atomic<int> finished = 0;
+    {
+        isc::AsyncLogger logger(sink, 2, isc::AsyncLogger::OverflowPolicy::Block);
+        log_without_executor(logger, 0, 50, finished);
+    }
+
+    check(finished.load() == 1, "a coroutine waiting at shutdown is resumed");
+    check(sink.entries().size() == 50, "messages waiting at shutdown are logged");
+
+    bool ordered                          = true;
+    const std::vector<SlowSink::Entry> entries = sink.entries();
+    for (std::size_t i = 0; i < entries.size(); ++i)
+        ordered = ordered && entries[i].code == i;
+    check(ordered, "messages waiting at shutdown are logged after those queued before them");
+}
+}
+
+int main()
+{
+    test_backpressure_and_trace();
+    test_no_executor();
+    test_shutdown_with_waiters();
+
+    if (s_failures > 0)
+        return EXIT_FAILURE;
+
+    std::puts("All coroutine tests passed.");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,86 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+#include <ISCLogs/ISCLogs.hpp>
+
+namespace
+{
+int s_failures = 0;
+
+void check(const std::string_view result, const std::string_view expected)
+{
+    if (result == expected)
+        return;
+
+    std::fprintf(stderr, "FAILED: got \"%.*s\", expected \"%.*s\"\n", static_cast<int>(result.size()), result.data(),
+                 static_cast<int>(expected.size()), expected.data());
+    ++s_failures;
+}
+
+// The expected results are what std::format gives, which the formatter used without it has to match.
+void test_specifications()
+{
+    using isc::util::FormatArgs;
+
+    check(FormatArgs("{} {} {}", 1, -2, "s").rendered(), "1 -2 s");
+    check(FormatArgs("{1} {0} {{}}", 1, 2).rendered(), "2 1 {}");
+    check(FormatArgs("{:>5}|{:<5}|{:^5}|", 1, 2, 3).rendered(), "    1|2    |  3  |");
+    check(FormatArgs("{:*^7}", "ab").rendered(), "**ab***");
+    check(FormatArgs("{:05}", -42).rendered(), "-0042");
+    check(FormatArgs("{:+d} {: d}", 5, 5).rendered(), "+5  5");
+    check(FormatArgs("{:#x} {:#X} {:#b} {:#o} {:o}", 255, 255, 5, 8, 0).rendered(), "0xff 0XFF 0b101 010 0");
+    check(FormatArgs("{:#010x}", 255).rendered(), "0x000000ff");
+    check(FormatArgs("{:c}", 66).rendered(), "B");
+    check(FormatArgs("{:.2f}", 3.14159).rendered(), "3.14");
+    check(FormatArgs("{:8.3f}|", 2.5).rendered(), "   2.500|");
+    check(FormatArgs("{:e} {:E}", 1234.5, 1234.5).rendered(), "1.234500e+03 1.234500E+03");
+    check(FormatArgs("{} {}", 0.1f, 0.1).rendered(), "0.1 0.1");
+    check(FormatArgs("{:.3}", 3.14159).rendered(), "3.14");
+    check(FormatArgs("{:g}", 1e20).rendered(), "1e+20");
+    check(FormatArgs("{:08}", -1.0 / 0.0).rendered(), "    -inf");
+    check(FormatArgs("{:.3s}|{:6}|", "abcdef", "ab").rendered(), "abc|ab    |");
+    check(FormatArgs("{} {:d} {:>6}", true, true, false).rendered(), "true 1  false");
+    check(FormatArgs("{} {:d} {:x}", 'A', 'A', 'A').rendered(), "A 65 41");
+    check(FormatArgs("{}", static_cast<const void*>(nullptr)).rendered(), "0x0");
+}
+
+// Arguments too large for the inline buffer are formatted right away, with the same specifications.
+void test_rendered_immediately()
+{
+    const std::string large(200, 'x');
+    const isc::util::FormatArgs args("{:.3}-{:03}", large, 7);
+    if (!args.is_rendered())
+    {
+        std::fputs("FAILED: arguments larger than the inline buffer are formatted right away\n", stderr);
+        ++s_failures;
+    }
+
+    check(args.rendered(), "xxx-007");
+}
+
+void test_messages()
+{
+    check(isc::ErrorMessage(404, "Not Found", "No resource with id {} in {}.", 7, "users").description(), "No resource with id 7 in users.");
+    check(isc::Message(404, "Not Found", isc::Message::Severity::Warning, "Took {:.1f}ms", 2.25).description(), "Took 2.2ms");
+    check(isc::ErrorMessage(404, "Not Found", "Descriptions without arguments keep {braces}").description(), "Descriptions without arguments keep {braces}");
+}
+}
+
+int main()
+{
+    test_specifications();
+    test_rendered_immediately();
+    test_messages();
+
+    if (s_failures > 0)
+        return EXIT_FAILURE;
+
+    std::puts("All format tests passed.");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,179 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <ISCLogs/BinaryFormat.hpp>
+#include <ISCLogs/TimestampFormatter.hpp>
+
+namespace
+{
+struct Filter
+{
+    isc::Message::Severity min_severity = isc::Message::Severity::Debug;
+    std::vector<unsigned int> codes;
+    std::optional<std::uint64_t> since;
+    std::optional<std::uint64_t> until;
+    bool details = false;
+};
+
+void print_usage(const char* program)
+{
+    std::fprintf(
+        stderr,
+        "Usage: %s [options] <segment>...\n"
+        "Decodes binary log segments written by isc::BinaryLogger into text.\n"
+        "\n"
+        "Options:\n"
+        "  --min-severity <name>  Only print records of at least this severity, e.g. Warning.\n"
+        "  --code <code>          Only print records with this code, can be given multiple times.\n"
+        "  --since <seconds>      Only print records logged at or after this unix time.\n"
+        "  --until <seconds>      Only print records logged before this unix time.\n"
+        "  --details              Prefix each record with its time, thread and location, and print its trace.\n",
+        program
+    );
+}
+
+std::uint64_t parse_time(const char* seconds)
+{
+    return static_cast<std::uint64_t>(std::strtod(seconds, nullptr) * 1e9);
+}
+
+bool matches(const isc::binary::Entry& entry, const Filter& filter)
+{
+    if (entry.severity < filter.min_severity)
+        return false;
+
+    if (filter.since && entry.timestamp < *filter.since)
+        return false;
+
+    if (filter.until && entry.timestamp >= *filter.until)
+        return false;
+
+    if (filter.codes.empty())
+        return true;
+
+    for (const unsigned int code : filter.codes)
+    {
+        if (entry.code == code)
+            return true;
+    }
+
+    return false;
+}
+
+void append_details(const isc::binary::Entry& entry, std::string& out)
+{
+    static const isc::util::TimestampFormatter s_timestamps;
+    s_timestamps.append(entry.timestamp, out);
+
+    char buffer[64];
+    std::snprintf(buffer, sizeof(buffer), " thread %llu ", static_cast<unsigned long long>(entry.thread_id));
+    out += buffer;
+    out += entry.file;
+    out += ':';
+    out += std::to_string(entry.line);
+    out += ' ';
+    out += entry.function;
+    out += " | ";
+}
+}
+
+int main(const int argc, char** argv)
+{
+    Filter filter;
+    std::vector<std::string> segments;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view argument = argv[i];
+        const bool has_value            = i + 1 < argc;
+
+        if (argument == "--min-severity" && has_value)
+        {
+            const auto severity = isc::Message::parse_severity(argv[++i]);
+            if (!severity)
+            {
+                std::fprintf(stderr, "Unknown severity: %s\n", argv[i]);
+                return EXIT_FAILURE;
+            }
+
+            filter.min_severity = *severity;
+        }
+        else if (argument == "--code" && has_value)
+            filter.codes.push_back(static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10)));
+        else if (argument == "--since" && has_value)
+            filter.since = parse_time(argv[++i]);
+        else if (argument == "--until" && has_value)
+            filter.until = parse_time(argv[++i]);
+        else if (argument == "--details")
+            filter.details = true;
+        else if (argument == "--help" || argument == "-h")
+        {
+            print_usage(argv[0]);
+            return EXIT_SUCCESS;
+        }
+        else if (argument.starts_with("--"))
+        {
+            std::fprintf(stderr, "Unknown option, or missing value: %s\n", argv[i]);
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        else
+            segments.emplace_back(argument);
+    }
+
+    if (segments.empty())
+    {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    int result = EXIT_SUCCESS;
+    std::string line;
+    isc::binary::Entry entry;
+
+    for (const std::string& segment : segments)
+    {
+        isc::binary::Reader reader(segment);
+        if (!reader.is_open())
+        {
+            std::fprintf(stderr, "Could not read segment: %s\n", segment.c_str());
+            result = EXIT_FAILURE;
+            continue;
+        }
+
+        while (reader.next(entry))
+        {
+            if (!matches(entry, filter))
+                continue;
+
+            line.clear();
+            if (filter.details)
+                append_details(entry, line);
+
+            entry.format_to(line);
+            line += '\n';
+
+            if (filter.details)
+            {
+                for (const std::string_view frame : entry.trace)
+                {
+                    line += "    at ";
+                    line += frame;
+                    line += '\n';
+                }
+            }
+
+            std::fwrite(line.data(), 1, line.size(), stdout);
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,160 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "Index.hpp"
+
+#include "Search.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+
+namespace isc::query
+{
+namespace
+{
+using Offsets = std::array<std::vector<std::uint64_t>, Index::severity_count>;
+
+void index_part(const std::string_view text, const std::string_view part, Offsets& out)
+{
+    const char* end      = part.data() + part.size();
+    const char* position = part.data();
+    while (position < end)
+    {
+        const char* stop = Search::find_byte(position, end, '\n');
+        if (const auto severity = Line::parse_severity(std::string_view(position, stop)))
+            out[static_cast<std::size_t>(*severity)].push_back(static_cast<std::uint64_t>(position - text.data()));
+
+        position = stop == end ? end : stop + 1;
+    }
+}
+} // namespace
+
+std::string Index::path_for(const std::string_view log_path)
+{
+    std::string path(log_path);
+    path += ".isqidx";
+    return path;
+}
+
+bool Index::build(const std::string_view text, const std::string& path, const unsigned int threads, std::array<std::uint64_t, severity_count>& counts)
+{
+    // A last line without its newline may still be being written, so it is left to be scanned.
+    const std::size_t last_newline = text.rfind('\n');
+    const std::string_view indexed = text.substr(0, last_newline == std::string_view::npos ? 0 : last_newline + 1);
+
+    const std::vector<std::string_view> parts = split_lines(indexed, min_part_size, threads);
+    std::vector<Offsets> offsets(parts.size());
+    parallel_for(parts.size(), threads, [&](const std::size_t i) { index_part(text, parts[i], offsets[i]); });
+
+    Header header{};
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version      = version;
+    header.tail_length  = static_cast<std::uint32_t>(std::min(tail_size, indexed.size()));
+    header.indexed_size = indexed.size();
+    if (header.tail_length > 0)
+        std::memcpy(header.tail, indexed.data() + indexed.size() - header.tail_length, header.tail_length);
+
+    for (std::size_t severity = 0; severity < severity_count; ++severity)
+    {
+        for (const Offsets& part : offsets)
+            header.counts[severity] += part[severity].size();
+
+        counts[severity] = header.counts[severity];
+    }
+
+    // Written next to the index and renamed over it, so a query never reads half of one.
+    const std::string temporary = path + ".tmp";
+    std::FILE* file             = std::fopen(temporary.c_str(), "wb");
+    if (file == nullptr)
+        return false;
+
+    bool written = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    for (std::size_t severity = 0; severity < severity_count && written; ++severity)
+    {
+        for (const Offsets& part : offsets)
+        {
+            const std::vector<std::uint64_t>& lines = part[severity];
+            if (!lines.empty() && std::fwrite(lines.data(), sizeof(std::uint64_t), lines.size(), file) != lines.size())
+                written = false;
+        }
+    }
+
+    written = std::fclose(file) == 0 && written;
+    if (!written || std::rename(temporary.c_str(), path.c_str()) != 0)
+    {
+        std::remove(temporary.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+Index::Index(const std::string& path, const std::string_view text) noexcept
+    : m_file(path)
+{
+    const std::string_view data = m_file.text();
+    if (data.size() < sizeof(Header))
+        return;
+
+    std::memcpy(&m_header, data.data(), sizeof(Header));
+    if (std::memcmp(m_header.magic, magic, sizeof(magic)) != 0 || m_header.version != version || m_header.tail_length > tail_size
+        || m_header.tail_length > m_header.indexed_size || m_header.indexed_size > text.size())
+        return;
+
+    std::uint64_t lines = 0;
+    for (const std::uint64_t count : m_header.counts)
+        lines += count;
+
+    if (lines > (data.size() - sizeof(Header)) / sizeof(std::uint64_t) || data.size() != sizeof(Header) + lines * sizeof(std::uint64_t))
+        return;
+
+    const std::size_t tail_offset = m_header.indexed_size - m_header.tail_length;
+    if (text.compare(tail_offset, m_header.tail_length, std::string_view(m_header.tail, m_header.tail_length)) != 0)
+        return;
+
+    m_file.advise(MappedFile::Access::Sequential);
+    m_valid = true;
+}
+
+bool Index::is_valid() const noexcept
+{
+    return m_valid;
+}
+
+std::uint64_t Index::indexed_size() const noexcept
+{
+    return m_valid ? m_header.indexed_size : 0;
+}
+
+std::vector<std::uint64_t> Index::offsets(const std::uint8_t severities) const
+{
+    std::vector<std::uint64_t> merged;
+    if (!m_valid)
+        return merged;
+
+    std::vector<std::uint64_t> scratch;
+    for (std::size_t severity = 0; severity < severity_count; ++severity)
+    {
+        if ((severities & Query::bit(static_cast<Message::Severity>(severity))) == 0)
+            continue;
+
+        const std::span<const std::uint64_t> lines = offsets_of(severity);
+        scratch.resize(merged.size() + lines.size());
+        std::merge(merged.begin(), merged.end(), lines.begin(), lines.end(), scratch.begin());
+        merged.swap(scratch);
+    }
+
+    return merged;
+}
+
+std::span<const std::uint64_t> Index::offsets_of(const std::size_t severity) const noexcept
+{
+    const std::uint64_t first = std::accumulate(m_header.counts, m_header.counts + severity, std::uint64_t(0));
+    // The mapping is page aligned, and the header a multiple of eight bytes, so the offsets are aligned.
+    const auto* offsets = reinterpret_cast<const std::uint64_t*>(m_file.text().data() + sizeof(Header));
+    return {offsets + first, static_cast<std::size_t>(m_header.counts[severity])};
+}
+} // isc::query
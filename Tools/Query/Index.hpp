@@ -0,0 +1,93 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "MappedFile.hpp"
+#include "Query.hpp"
+
+namespace isc::query
+{
+/**
+ * A sidecar file next to a log that holds the offsets of its lines, grouped by severity, so that queries for some
+ * severities only touch the lines of those severities.
+ * The index covers the log up to the end of its last whole line when it was built. A log that has been appended to
+ * since still uses it for that part, and only the rest is scanned. A log that has been rewritten is detected by the last
+ * bytes of the indexed part no longer matching, and the index is ignored.
+ */
+class Index
+{
+public:
+    static constexpr char magic[8]              = {'I', 'S', 'C', 'Q', 'I', 'D', 'X', '\0'};
+    static constexpr std::uint32_t version      = 1;
+    static constexpr std::size_t tail_size      = 64;
+    static constexpr std::size_t severity_count = 6;
+
+    // Followed by the offsets of the lines of each severity in turn, from Debug to Fatal, each in file order.
+    struct Header
+    {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t tail_length;
+        std::uint64_t indexed_size;
+        std::uint64_t counts[severity_count];
+        // The last bytes of the indexed part of the log.
+        char tail[tail_size];
+    };
+
+    /**
+     * Returns the path of the index of a log.
+     * @param log_path The path of the log.
+     */
+    [[nodiscard]] static std::string path_for(std::string_view log_path);
+
+    /**
+     * Indexes the lines of a log, and writes the index to a file, replacing any index already there.
+     * @param text The contents of the log.
+     * @param path The path to write the index to.
+     * @param threads The most threads to index with.
+     * @param counts Set to the amount of lines of each severity.
+     * @return Whether the index could be written.
+     */
+    static bool build(std::string_view text, const std::string& path, unsigned int threads, std::array<std::uint64_t, severity_count>& counts);
+
+    /**
+     * Opens the index of a log, see is_valid.
+     * @param path The path of the index.
+     * @param text The contents of the log, to check that the index still describes it.
+     */
+    Index(const std::string& path, std::string_view text) noexcept;
+
+    /**
+     * Returns whether the index could be read, and describes the start of the log.
+     */
+    [[nodiscard]] bool is_valid() const noexcept;
+
+    /**
+     * Returns the size of the part of the log that the index covers, the rest has to be scanned.
+     */
+    [[nodiscard]] std::uint64_t indexed_size() const noexcept;
+
+    /**
+     * Returns the offsets of the lines of some severities, in file order.
+     * @param severities The severities, one bit per severity, see Query::bit.
+     */
+    [[nodiscard]] std::vector<std::uint64_t> offsets(std::uint8_t severities) const;
+
+private:
+    [[nodiscard]] std::span<const std::uint64_t> offsets_of(std::size_t severity) const noexcept;
+
+    MappedFile m_file;
+    Header m_header = {};
+    bool m_valid    = false;
+};
+} // isc::query
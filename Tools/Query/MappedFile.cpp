@@ -0,0 +1,61 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "MappedFile.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace isc::query
+{
+MappedFile::MappedFile(const std::string& path) noexcept
+{
+    const int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file == -1)
+        return;
+
+    struct stat status{};
+    if (::fstat(file, &status) == 0)
+    {
+        if (status.st_size == 0)
+            m_open = true;
+        else
+        {
+            void* data = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+            if (data != MAP_FAILED)
+            {
+                m_data = static_cast<const char*>(data);
+                m_size = static_cast<std::size_t>(status.st_size);
+                m_open = true;
+            }
+        }
+    }
+
+    ::close(file);
+}
+
+MappedFile::~MappedFile() noexcept
+{
+    if (m_data != nullptr)
+        ::munmap(const_cast<char*>(m_data), m_size);
+}
+
+bool MappedFile::is_open() const noexcept
+{
+    return m_open;
+}
+
+std::string_view MappedFile::text() const noexcept
+{
+    return {m_data, m_size};
+}
+
+void MappedFile::advise(const Access access) const noexcept
+{
+    if (m_data != nullptr)
+        ::madvise(const_cast<char*>(m_data), m_size, access == Access::Sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+}
+} // isc::query
@@ -0,0 +1,58 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace isc::query
+{
+/**
+ * A file mapped read-only into memory, so that its text can be searched in place by any amount of threads.
+ */
+class MappedFile
+{
+public:
+    // How the file is going to be read, which tells the kernel how far to read ahead.
+    enum class Access : std::uint8_t
+    {
+        Sequential,
+        Random
+    };
+
+    /**
+     * Maps a file, see is_open. An empty file is open, with empty text.
+     * @param path The path of the file.
+     */
+    explicit MappedFile(const std::string& path) noexcept;
+    ~MappedFile() noexcept;
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * Returns whether the file could be opened and mapped.
+     */
+    [[nodiscard]] bool is_open() const noexcept;
+
+    /**
+     * Returns the contents of the file.
+     */
+    [[nodiscard]] std::string_view text() const noexcept;
+
+    /**
+     * Tells the kernel how the file is going to be read.
+     * @param access Sequential for full scans, Random when jumping between indexed lines.
+     */
+    void advise(Access access) const noexcept;
+
+private:
+    const char* m_data = nullptr;
+    std::size_t m_size = 0;
+    bool m_open        = false;
+};
+} // isc::query
@@ -0,0 +1,388 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "Query.hpp"
+
+#include "Search.hpp"
+
+#include <bit>
+#include <charconv>
+
+namespace isc::query
+{
+namespace
+{
+// The keys that the JSON and logfmt encoders write, in the order they write them.
+struct Keys
+{
+    std::string_view severity;
+    std::string_view code;
+    std::string_view name;
+    std::string_view description;
+    char value_end;
+};
+
+constexpr Keys s_json   = {"\"severity\":\"", "\"code\":", "\"name\":", ",\"description\":", '"'};
+constexpr Keys s_logfmt = {" severity=", " code=", " name=", " description=", ' '};
+
+const char* find(const std::string_view text, const std::string_view needle, const char* from) noexcept
+{
+    return Search::find(from, text.data() + text.size(), needle);
+}
+
+const Keys* keys_of(const std::string_view text) noexcept
+{
+    if (text.starts_with('{'))
+        return &s_json;
+    if (text.starts_with("time="))
+        return &s_logfmt;
+    return nullptr;
+}
+
+// Returns the position just after the severity's value, or nullptr if there is none.
+const char* find_severity(const std::string_view text, const Keys* keys, std::optional<Message::Severity>& severity) noexcept
+{
+    const char* end = text.data() + text.size();
+
+    if (keys == nullptr)
+    {
+        // Text lines start with the severity tag, after the timestamp if there is one.
+        const char* open  = Search::find_byte(text.data(), end, '[');
+        const char* close = Search::find_byte(open, end, ']');
+        if (close == end || end - close < 2 || close[1] != ':')
+            return nullptr;
+
+        severity = Message::parse_severity(std::string_view(open + 1, close));
+        return close + 2;
+    }
+
+    const char* key = find(text, keys->severity, text.data());
+    if (key == end)
+        return nullptr;
+
+    const char* value = key + keys->severity.size();
+    const char* stop  = Search::find_byte(value, end, keys->value_end);
+    severity          = Message::parse_severity(std::string_view(value, stop));
+    return stop;
+}
+
+// Characters that the JSON and logfmt encoders escape inside quotes.
+constexpr bool is_escaped(const char character) noexcept
+{
+    return character == '"' || character == '\\' || static_cast<unsigned char>(character) < 0x20;
+}
+
+// Reads the value starting at from, quoted, or bare up to the next space as logfmt writes values that need no quotes.
+// Returns the position just after the value.
+const char* read_value(const char* from, const char* end, std::string_view& value) noexcept
+{
+    if (from == end || *from != '"')
+    {
+        const char* stop = Search::find_byte(from, end, ' ');
+        value            = std::string_view(from, stop);
+        return stop;
+    }
+
+    const char* first = from + 1;
+    const char* close = Search::find_byte(first, end, '"');
+    while (close != end)
+    {
+        // A quote is escaped if it follows an odd amount of backslashes.
+        std::size_t backslashes = 0;
+        for (const char* previous = close; previous > first && previous[-1] == '\\'; --previous)
+            ++backslashes;
+        if (backslashes % 2 == 0)
+            break;
+
+        close = Search::find_byte(close + 1, end, '"');
+    }
+
+    value = std::string_view(first, close);
+    return close == end ? end : close + 1;
+}
+
+void append_utf8(const std::uint32_t code_point, std::string& out)
+{
+    if (code_point < 0x80)
+    {
+        out += static_cast<char>(code_point);
+    }
+    else if (code_point < 0x800)
+    {
+        out += static_cast<char>(0xC0 | (code_point >> 6));
+        out += static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+    else
+    {
+        out += static_cast<char>(0xE0 | (code_point >> 12));
+        out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+}
+
+// Appends a quoted value with its escapes undone, escapes that are cut short are appended as they are.
+void unescape(const std::string_view value, std::string& out)
+{
+    for (std::size_t i = 0; i < value.size(); ++i)
+    {
+        if (value[i] != '\\' || i + 1 == value.size())
+        {
+            out += value[i];
+            continue;
+        }
+
+        switch (const char escape = value[++i])
+        {
+        case 'n':
+            out += '\n';
+            break;
+        case 'r':
+            out += '\r';
+            break;
+        case 't':
+            out += '\t';
+            break;
+        case 'b':
+            out += '\b';
+            break;
+        case 'f':
+            out += '\f';
+            break;
+        case 'u':
+        {
+            std::uint32_t code_point = 0;
+            const char* digits       = value.data() + i + 1;
+            const char* stop         = value.data() + std::min(value.size(), i + 5);
+            if (const auto [last, error] = std::from_chars(digits, stop, code_point, 16); error == std::errc() && last == digits + 4)
+            {
+                append_utf8(code_point, out);
+                i += 4;
+            }
+            else
+            {
+                out += "\\u";
+            }
+            break;
+        }
+        default:
+            out += escape;
+            break;
+        }
+    }
+}
+
+bool value_contains(const std::string_view value, const bool escaped, const std::string_view text) noexcept
+{
+    const char* end = value.data() + value.size();
+    if (!escaped || Search::find_byte(value.data(), end, '\\') == end)
+        return Search::find(value.data(), end, text) != end;
+
+    try
+    {
+        thread_local std::string t_unescaped;
+        t_unescaped.clear();
+        unescape(value, t_unescaped);
+
+        const char* unescaped_end = t_unescaped.data() + t_unescaped.size();
+        return Search::find(t_unescaped.data(), unescaped_end, text) != unescaped_end;
+    }
+    catch (...)
+    {
+        return Search::find(value.data(), end, text) != end;
+    }
+}
+} // namespace
+
+Line Line::parse(const std::string_view text) noexcept
+{
+    Line line;
+    const Keys* keys    = keys_of(text);
+    const char* end     = text.data() + text.size();
+    const char* current = find_severity(text, keys, line.severity);
+    if (current == nullptr)
+        return line;
+
+    if (keys == nullptr)
+    {
+        line.name = std::string_view(current, end);
+        if (line.name.starts_with(' '))
+            line.name.remove_prefix(1);
+
+        return line;
+    }
+
+    line.escaped = true;
+
+    const char* code = find(text, keys->code, current);
+    if (code != end)
+    {
+        unsigned int value = 0;
+        const char* digits = code + keys->code.size();
+        if (const auto [stop, error] = std::from_chars(digits, end, value); error == std::errc() && stop != digits)
+        {
+            line.code = value;
+            current   = stop;
+        }
+    }
+
+    const char* name = find(text, keys->name, current);
+    if (name == end)
+        return line;
+
+    current = read_value(name + keys->name.size(), end, line.name);
+
+    // The description comes right after the name, if the message has one.
+    if (std::string_view(current, end).starts_with(keys->description))
+        read_value(current + keys->description.size(), end, line.description);
+
+    return line;
+}
+
+bool Line::contains(const std::string_view text) const noexcept
+{
+    return value_contains(name, escaped, text) || value_contains(description, escaped, text);
+}
+
+std::optional<Message::Severity> Line::parse_severity(const std::string_view text) noexcept
+{
+    std::optional<Message::Severity> severity;
+    find_severity(text, keys_of(text), severity);
+    return severity;
+}
+
+bool Query::filters_severity() const noexcept
+{
+    return severities != all_severities;
+}
+
+std::string Query::anchor() const
+{
+    std::string anchor;
+    const auto consider = [&](const std::string_view candidate) {
+        if (candidate.size() > anchor.size())
+            anchor = candidate;
+    };
+
+    // Every line of a single severity contains its name, in any encoding.
+    if (std::popcount(severities) == 1)
+        consider(Message::severity_name(static_cast<Message::Severity>(std::countr_zero(severities))));
+
+    if (codes.size() == 1)
+        consider(std::to_string(codes.front()));
+
+    for (const std::string& substring : substrings)
+    {
+        std::size_t start = 0;
+        for (std::size_t i = 0; i <= substring.size(); ++i)
+        {
+            if (i < substring.size() && !is_escaped(substring[i]))
+                continue;
+
+            consider(std::string_view(substring).substr(start, i - start));
+            start = i + 1;
+        }
+    }
+
+    return anchor;
+}
+
+bool Query::matches(const std::string_view line) const noexcept
+{
+    if (!filters_severity() && codes.empty() && substrings.empty())
+        return true;
+
+    const Line parsed = Line::parse(line);
+    if (filters_severity() && (!parsed.severity || (severities & bit(*parsed.severity)) == 0))
+        return false;
+
+    if (!codes.empty() && (!parsed.code || std::find(codes.begin(), codes.end(), *parsed.code) == codes.end()))
+        return false;
+
+    for (const std::string& substring : substrings)
+    {
+        if (!parsed.contains(substring))
+            return false;
+    }
+
+    return true;
+}
+
+std::vector<std::string_view> split_lines(const std::string_view text, const std::size_t min_size, const std::size_t max_parts)
+{
+    const std::size_t count = std::clamp<std::size_t>(text.size() / std::max<std::size_t>(min_size, 1), 1, std::max<std::size_t>(max_parts, 1));
+    const std::size_t size  = text.size() / count;
+
+    std::vector<std::string_view> parts;
+    parts.reserve(count);
+
+    const char* end   = text.data() + text.size();
+    const char* first = text.data();
+    for (std::size_t i = 1; i < count && first < end; ++i)
+    {
+        // Each part ends just after the first newline past its share of the text.
+        const char* target = std::max(first, text.data() + i * size);
+        const char* stop   = Search::find_byte(target, end, '\n');
+        if (stop == end)
+            break;
+
+        parts.emplace_back(first, stop + 1);
+        first = stop + 1;
+    }
+
+    if (first < end || parts.empty())
+        parts.emplace_back(first, end);
+
+    return parts;
+}
+
+void scan(const Query& query, const std::string_view text, const bool count_only, Matches& out)
+{
+    const std::string anchor = query.anchor();
+    const char* end          = text.data() + text.size();
+    const char* position     = text.data();
+
+    while (position < end)
+    {
+        const char* start = position;
+        if (!anchor.empty())
+        {
+            const char* hit = Search::find(position, end, anchor);
+            if (hit == end)
+                break;
+
+            start = Search::line_start(position, hit);
+        }
+
+        const char* stop = Search::find_byte(start, end, '\n');
+        const std::string_view line(start, stop);
+        if (query.matches(line))
+        {
+            ++out.count;
+            if (!count_only)
+                out.lines.push_back(line);
+        }
+
+        position = stop == end ? end : stop + 1;
+    }
+}
+
+void scan_lines(const Query& query, const std::string_view text, const std::span<const std::uint64_t> offsets, const bool count_only, Matches& out)
+{
+    const char* end = text.data() + text.size();
+    for (const std::uint64_t offset : offsets)
+    {
+        if (offset >= text.size())
+            break;
+
+        const char* start = text.data() + offset;
+        const std::string_view line(start, Search::find_byte(start, end, '\n'));
+        if (query.matches(line))
+        {
+            ++out.count;
+            if (!count_only)
+                out.lines.push_back(line);
+        }
+    }
+}
+} // isc::query
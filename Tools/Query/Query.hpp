@@ -0,0 +1,169 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <ISCLogs/Message.hpp>
+
+namespace isc::query
+{
+// Parts of a file smaller than this are not worth a thread of their own.
+inline constexpr std::size_t min_part_size = 1024 * 1024;
+
+/**
+ * The parts of a line that a query looks at, for lines written in any of the Text, JSON and logfmt encodings.
+ * Text lines carry no code, so only JSON and logfmt lines have one.
+ */
+struct Line
+{
+    std::optional<Message::Severity> severity;
+    std::optional<unsigned int> code;
+    // The name and description as they are written in the line, without their quotes, so possibly still escaped.
+    // Text lines are not escaped and cannot be told apart reliably, so their name holds the rest of the line.
+    std::string_view name;
+    std::string_view description;
+    // Whether the name and description may hold escapes, as the quoted values of JSON and logfmt lines do.
+    bool escaped = false;
+
+    /**
+     * Parses a line, parts that cannot be found are left empty.
+     * @param text The line, without its newline.
+     */
+    [[nodiscard]] static Line parse(std::string_view text) noexcept;
+
+    /**
+     * Returns whether the name or the description contains text, once their escapes are undone.
+     * @param text The text to look for.
+     */
+    [[nodiscard]] bool contains(std::string_view text) const noexcept;
+
+    /**
+     * Parses only the severity of a line, see parse.
+     * @param text The line, without its newline.
+     */
+    [[nodiscard]] static std::optional<Message::Severity> parse_severity(std::string_view text) noexcept;
+};
+
+/**
+ * The conditions a line has to meet to match, every condition that is given has to hold.
+ */
+struct Query
+{
+    static constexpr std::uint8_t all_severities = 0x3F;
+
+    // One bit per severity, see bit. Lines without a severity only match if every bit is set.
+    std::uint8_t severities = all_severities;
+    // The line's code has to be one of these, if any are given.
+    std::vector<unsigned int> codes;
+    // Every one of these has to occur in the line's name or description.
+    std::vector<std::string> substrings;
+
+    /**
+     * Returns the bit of a severity in severities.
+     * @param severity The severity.
+     */
+    [[nodiscard]] static constexpr std::uint8_t bit(Message::Severity severity) noexcept;
+
+    /**
+     * Returns whether only some severities match.
+     */
+    [[nodiscard]] bool filters_severity() const noexcept;
+
+    /**
+     * Returns the longest text that every matching line contains, which is searched for instead of reading every line.
+     * Only runs of a substring that no encoding escapes are considered, since the line holds the substring escaped.
+     * @return The text, or an empty string if every line has to be read.
+     */
+    [[nodiscard]] std::string anchor() const;
+
+    /**
+     * Returns whether a line matches.
+     * @param line The line, without its newline.
+     */
+    [[nodiscard]] bool matches(std::string_view line) const noexcept;
+};
+
+/**
+ * The lines that matched in one part of a file, in the order they appear in.
+ */
+struct Matches
+{
+    std::uint64_t count = 0;
+    // Left empty when only counting.
+    std::vector<std::string_view> lines;
+};
+
+/**
+ * Splits text into parts that start and end on line boundaries, to be scanned in parallel.
+ * @param text The text to split.
+ * @param min_size The smallest a part should be, so that small files are not spread over threads for nothing.
+ * @param max_parts The most parts to split the text into.
+ * @return The parts, in order, at least one.
+ */
+[[nodiscard]] std::vector<std::string_view> split_lines(std::string_view text, std::size_t min_size, std::size_t max_parts);
+
+/**
+ * Finds the lines of text that match a query.
+ * If the query has an anchor, only the lines it occurs in are parsed, otherwise every line is.
+ * @param query The query to match.
+ * @param text Whole lines, the last one may lack its newline.
+ * @param count_only Whether to only count the matching lines.
+ * @param out The matches to append to.
+ */
+void scan(const Query& query, std::string_view text, bool count_only, Matches& out);
+
+/**
+ * Finds the lines starting at the given offsets that match a query.
+ * @param query The query to match.
+ * @param text The text that the offsets point into.
+ * @param offsets The offsets of the lines to check, in order.
+ * @param count_only Whether to only count the matching lines.
+ * @param out The matches to append to.
+ */
+void scan_lines(const Query& query, std::string_view text, std::span<const std::uint64_t> offsets, bool count_only, Matches& out);
+
+/**
+ * Calls a function once for every index below count, spread over the given amount of threads.
+ * Indices are handed out one at a time, so uneven parts keep every thread busy.
+ * @param count The amount of indices.
+ * @param threads The most threads to use, including the calling one.
+ * @param function The function to call with each index.
+ */
+template <typename Function>
+void parallel_for(std::size_t count, unsigned int threads, Function&& function);
+
+constexpr std::uint8_t Query::bit(const Message::Severity severity) noexcept
+{
+    return static_cast<std::uint8_t>(1u << static_cast<unsigned int>(severity));
+}
+
+template <typename Function>
+void parallel_for(const std::size_t count, const unsigned int threads, Function&& function)
+{
+    std::atomic<std::size_t> next = 0;
+    const auto work               = [&] {
+        for (std::size_t i = next.fetch_add(1, std::memory_order_relaxed); i < count; i = next.fetch_add(1, std::memory_order_relaxed))
+            function(i);
+    };
+
+    std::vector<std::jthread> workers;
+    const std::size_t extra = std::min<std::size_t>(std::max(threads, 1u), count) - (count > 0 ? 1 : 0);
+    workers.reserve(extra);
+    for (std::size_t i = 0; i < extra; ++i)
+        workers.emplace_back(work);
+
+    work();
+}
+} // isc::query
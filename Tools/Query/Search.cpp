@@ -0,0 +1,223 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include "Search.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define ISCLOGS_QUERY_X86 1
+#endif
+
+namespace isc::query
+{
+namespace
+{
+std::atomic<Search::Isa> s_isa = Search::supported();
+
+const char* find_byte_scalar(const char* first, const char* last, const char byte) noexcept
+{
+    return std::find(first, last, byte);
+}
+
+const char* find_scalar(const char* first, const char* last, const std::string_view needle) noexcept
+{
+    const char head     = needle.front();
+    const char* scanned = last - (needle.size() - 1);
+    for (; first < scanned; ++first)
+    {
+        if (*first == head && std::memcmp(first + 1, needle.data() + 1, needle.size() - 1) == 0)
+            return first;
+    }
+
+    return last;
+}
+
+#if defined(ISCLOGS_QUERY_X86)
+__attribute__((target("sse4.2"))) const char* find_byte_sse42(const char* first, const char* last, const char byte) noexcept
+{
+    const __m128i pattern = _mm_set1_epi8(byte);
+    for (; last - first >= 16; first += 16)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        const auto mask     = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, pattern)));
+        if (mask != 0)
+            return first + std::countr_zero(mask);
+    }
+
+    return find_byte_scalar(first, last, byte);
+}
+
+__attribute__((target("avx2"))) const char* find_byte_avx2(const char* first, const char* last, const char byte) noexcept
+{
+    const __m256i pattern = _mm256_set1_epi8(byte);
+    for (; last - first >= 32; first += 32)
+    {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+        const auto mask     = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, pattern)));
+        if (mask != 0)
+            return first + std::countr_zero(mask);
+    }
+
+    return find_byte_sse42(first, last, byte);
+}
+
+// Each vector holds the candidates starting at 16 positions, a candidate is only compared in full if both its first and
+// last characters match, which rules out nearly every position in ordinary text.
+__attribute__((target("sse4.2"))) const char* find_sse42(const char* first, const char* last, const std::string_view needle) noexcept
+{
+    const std::size_t tail_offset = needle.size() - 1;
+    const __m128i head            = _mm_set1_epi8(needle.front());
+    const __m128i tail            = _mm_set1_epi8(needle.back());
+
+    for (; static_cast<std::size_t>(last - first) >= tail_offset + 16; first += 16)
+    {
+        const __m128i heads = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        const __m128i tails = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + tail_offset));
+        auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(heads, head), _mm_cmpeq_epi8(tails, tail))));
+
+        while (mask != 0)
+        {
+            const int offset = std::countr_zero(mask);
+            if (std::memcmp(first + offset + 1, needle.data() + 1, needle.size() - 2) == 0)
+                return first + offset;
+
+            mask &= mask - 1;
+        }
+    }
+
+    return find_scalar(first, last, needle);
+}
+
+__attribute__((target("avx2"))) const char* find_avx2(const char* first, const char* last, const std::string_view needle) noexcept
+{
+    const std::size_t tail_offset = needle.size() - 1;
+    const __m256i head            = _mm256_set1_epi8(needle.front());
+    const __m256i tail            = _mm256_set1_epi8(needle.back());
+
+    for (; static_cast<std::size_t>(last - first) >= tail_offset + 32; first += 32)
+    {
+        const __m256i heads = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+        const __m256i tails = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + tail_offset));
+        auto mask           = static_cast<std::uint32_t>(
+            _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(heads, head), _mm256_cmpeq_epi8(tails, tail)))
+        );
+
+        while (mask != 0)
+        {
+            const int offset = std::countr_zero(mask);
+            if (std::memcmp(first + offset + 1, needle.data() + 1, needle.size() - 2) == 0)
+                return first + offset;
+
+            mask &= mask - 1;
+        }
+    }
+
+    return find_sse42(first, last, needle);
+}
+#endif
+} // namespace
+
+Search::Isa Search::supported() noexcept
+{
+#if defined(ISCLOGS_QUERY_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return Isa::Avx2;
+    if (__builtin_cpu_supports("sse4.2"))
+        return Isa::Sse42;
+#endif
+    return Isa::Scalar;
+}
+
+Search::Isa Search::isa() noexcept
+{
+    return s_isa.load(std::memory_order_relaxed);
+}
+
+void Search::set_isa(const Isa isa) noexcept
+{
+    s_isa.store(std::min(isa, supported()), std::memory_order_relaxed);
+}
+
+std::string_view Search::isa_name(const Isa isa) noexcept
+{
+    switch (isa)
+    {
+    case Isa::Scalar:
+        return "scalar";
+    case Isa::Sse42:
+        return "sse4.2";
+    case Isa::Avx2:
+        return "avx2";
+    default:
+        return "unknown";
+    }
+}
+
+std::optional<Search::Isa> Search::parse_isa(const std::string_view name) noexcept
+{
+    for (const Isa isa : {Isa::Scalar, Isa::Sse42, Isa::Avx2})
+    {
+        if (isa_name(isa) == name)
+            return isa;
+    }
+
+    return std::nullopt;
+}
+
+const char* Search::find_byte(const char* first, const char* last, const char byte) noexcept
+{
+#if defined(ISCLOGS_QUERY_X86)
+    switch (isa())
+    {
+    case Isa::Avx2:
+        return find_byte_avx2(first, last, byte);
+    case Isa::Sse42:
+        return find_byte_sse42(first, last, byte);
+    default:
+        break;
+    }
+#endif
+    return find_byte_scalar(first, last, byte);
+}
+
+const char* Search::find(const char* first, const char* last, const std::string_view needle) noexcept
+{
+    if (needle.empty())
+        return first;
+
+    if (static_cast<std::size_t>(last - first) < needle.size())
+        return last;
+
+    if (needle.size() == 1)
+        return find_byte(first, last, needle.front());
+
+#if defined(ISCLOGS_QUERY_X86)
+    switch (isa())
+    {
+    case Isa::Avx2:
+        return find_avx2(first, last, needle);
+    case Isa::Sse42:
+        return find_sse42(first, last, needle);
+    default:
+        break;
+    }
+#endif
+    return find_scalar(first, last, needle);
+}
+
+const char* Search::line_start(const char* first, const char* position) noexcept
+{
+    // Lines are short, so walking back is cheaper than setting up a vector search.
+    while (position > first && position[-1] != '\n')
+        --position;
+
+    return position;
+}
+} // isc::query
@@ -0,0 +1,87 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace isc::query
+{
+/**
+ * Byte and substring searches over mapped log text.
+ * Each search has an AVX2, an SSE4.2 and a scalar version, the best one the processor supports is picked at runtime,
+ * so the tool is built for the baseline architecture and still uses the wide instructions where they exist.
+ */
+class Search
+{
+public:
+    // The instruction sets a search can use, from the narrowest to the widest.
+    enum class Isa : std::uint8_t
+    {
+        Scalar,
+        Sse42,
+        Avx2
+    };
+
+    Search() = delete;
+
+    /**
+     * Returns the widest instruction set that the processor supports.
+     */
+    [[nodiscard]] static Isa supported() noexcept;
+
+    /**
+     * Returns the instruction set that searches currently use.
+     */
+    [[nodiscard]] static Isa isa() noexcept;
+
+    /**
+     * Changes the instruction set that searches use, e.g. to compare them.
+     * @param isa The instruction set to use, narrowed to what the processor supports.
+     */
+    static void set_isa(Isa isa) noexcept;
+
+    /**
+     * Returns the name of an instruction set, as accepted by parse_isa.
+     * @param isa The instruction set to name.
+     */
+    [[nodiscard]] static std::string_view isa_name(Isa isa) noexcept;
+
+    /**
+     * Parses the name of an instruction set, e.g. "avx2".
+     * @param name The name to parse, case-sensitive.
+     * @return The instruction set, or nullopt if the name is unknown.
+     */
+    [[nodiscard]] static std::optional<Isa> parse_isa(std::string_view name) noexcept;
+
+    /**
+     * Finds the first occurrence of a byte.
+     * @param first The start of the text to search.
+     * @param last The end of the text to search.
+     * @param byte The byte to find.
+     * @return The position of the byte, or last if it does not occur.
+     */
+    [[nodiscard]] static const char* find_byte(const char* first, const char* last, char byte) noexcept;
+
+    /**
+     * Finds the first occurrence of a substring, by comparing its first and last characters a whole vector at a time,
+     * and only comparing the rest where both match.
+     * @param first The start of the text to search.
+     * @param last The end of the text to search.
+     * @param needle The substring to find, an empty one is found at first.
+     * @return The start of the occurrence, or last if it does not occur.
+     */
+    [[nodiscard]] static const char* find(const char* first, const char* last, std::string_view needle) noexcept;
+
+    /**
+     * Finds the start of the line that a position is in.
+     * @param first The start of the text, which a line starts at.
+     * @param position A position in the text.
+     * @return The position just after the last newline before position, or first if there is none.
+     */
+    [[nodiscard]] static const char* line_start(const char* first, const char* position) noexcept;
+};
+} // isc::query
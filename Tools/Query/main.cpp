@@ -0,0 +1,253 @@
+//
+// Created by An Inconspicuous Semicolon on 16/10/2026.
+//
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Index.hpp"
+#include "MappedFile.hpp"
+#include "Query.hpp"
+#include "Search.hpp"
+
+namespace
+{
+// Lines looked up through the index are handed out in batches of this many.
+constexpr std::size_t s_lines_per_batch = 64 * 1024;
+
+struct Options
+{
+    isc::query::Query query;
+    unsigned int threads = std::max(std::thread::hardware_concurrency(), 1u);
+    bool count           = false;
+    bool use_index       = true;
+    bool build_index     = false;
+};
+
+void print_usage(const char* program)
+{
+    std::fprintf(
+        stderr,
+        "Usage: %s [options] <log>...\n"
+        "Prints the lines of text, JSON or logfmt logs written by ISCLogs that match every given condition.\n"
+        "\n"
+        "Options:\n"
+        "  --severity <name>      Only print lines of this severity, can be given multiple times.\n"
+        "  --min-severity <name>  Only print lines of at least this severity, e.g. Warning.\n"
+        "  --code <code>          Only print lines with this code, can be given multiple times. Text lines have no code.\n"
+        "  --contains <text>      Only print lines whose name or description contain this text, can be given multiple times.\n"
+        "  --count                Print the amount of matching lines instead of the lines.\n"
+        "  --threads <count>      The most threads to scan with, defaults to one per core.\n"
+        "  --isa <name>           The widest instructions to scan with: avx2, sse4.2 or scalar.\n"
+        "  --build-index          Write a sidecar index of each log's lines by severity, instead of querying.\n"
+        "  --no-index             Scan every line, even where an index exists.\n",
+        program
+    );
+}
+
+std::optional<isc::Message::Severity> parse_severity(const char* name)
+{
+    const auto severity = isc::Message::parse_severity(name);
+    if (!severity)
+        std::fprintf(stderr, "Unknown severity: %s\n", name);
+
+    return severity;
+}
+
+bool build_index(const std::string& path, const std::string_view text, const Options& options)
+{
+    std::array<std::uint64_t, isc::query::Index::severity_count> counts{};
+    if (!isc::query::Index::build(text, isc::query::Index::path_for(path), options.threads, counts))
+    {
+        std::fprintf(stderr, "Could not write the index of: %s\n", path.c_str());
+        return false;
+    }
+
+    std::fprintf(stderr, "%s:", path.c_str());
+    for (std::size_t i = 0; i < counts.size(); ++i)
+    {
+        const std::string_view name = isc::Message::severity_name(static_cast<isc::Message::Severity>(i));
+        std::fprintf(stderr, " %.*s=%llu", static_cast<int>(name.size()), name.data(), static_cast<unsigned long long>(counts[i]));
+    }
+    std::fputc('\n', stderr);
+    return true;
+}
+
+std::vector<isc::query::Matches> query(const std::string& path, const isc::query::MappedFile& file, const Options& options)
+{
+    const isc::query::Query& query = options.query;
+    std::string_view text          = file.text();
+    std::vector<isc::query::Matches> results;
+
+    if (options.use_index && query.filters_severity())
+    {
+        const isc::query::Index index(isc::query::Index::path_for(path), text);
+        if (index.is_valid())
+        {
+            file.advise(isc::query::MappedFile::Access::Random);
+
+            const std::vector<std::uint64_t> offsets = index.offsets(query.severities);
+            const std::size_t batches                = (offsets.size() + s_lines_per_batch - 1) / s_lines_per_batch;
+            results.resize(batches);
+            isc::query::parallel_for(batches, options.threads, [&](const std::size_t i) {
+                const std::span<const std::uint64_t> batch = std::span(offsets).subspan(i * s_lines_per_batch);
+                isc::query::scan_lines(query, text, batch.first(std::min(batch.size(), s_lines_per_batch)), options.count, results[i]);
+            });
+
+            // Whatever was appended since the index was built is scanned like a log without one.
+            text.remove_prefix(index.indexed_size());
+        }
+    }
+
+    if (results.empty())
+        file.advise(isc::query::MappedFile::Access::Sequential);
+
+    const std::vector<std::string_view> parts = isc::query::split_lines(text, isc::query::min_part_size, options.threads * 4);
+    const std::size_t first                   = results.size();
+    results.resize(first + parts.size());
+    isc::query::parallel_for(parts.size(), options.threads, [&](const std::size_t i) {
+        isc::query::scan(query, parts[i], options.count, results[first + i]);
+    });
+
+    return results;
+}
+
+void print(const std::string& path, const std::vector<isc::query::Matches>& results, const Options& options, const bool prefix)
+{
+    if (options.count)
+    {
+        std::uint64_t count = 0;
+        for (const isc::query::Matches& matches : results)
+            count += matches.count;
+
+        if (prefix)
+            std::printf("%s:", path.c_str());
+        std::printf("%llu\n", static_cast<unsigned long long>(count));
+        return;
+    }
+
+    for (const isc::query::Matches& matches : results)
+    {
+        for (const std::string_view line : matches.lines)
+        {
+            if (prefix)
+            {
+                std::fwrite(path.data(), 1, path.size(), stdout);
+                std::fputc(':', stdout);
+            }
+            std::fwrite(line.data(), 1, line.size(), stdout);
+            std::fputc('\n', stdout);
+        }
+    }
+}
+}
+
+int main(const int argc, char** argv)
+{
+    Options options;
+    bool severities_given = false;
+    std::vector<std::string> logs;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view argument = argv[i];
+        const bool has_value            = i + 1 < argc;
+
+        if (argument == "--severity" && has_value)
+        {
+            const auto severity = parse_severity(argv[++i]);
+            if (!severity)
+                return EXIT_FAILURE;
+
+            // The first severity given replaces the default of every severity, later ones add to it.
+            options.query.severities = (severities_given ? options.query.severities : 0) | isc::query::Query::bit(*severity);
+            severities_given         = true;
+        }
+        else if (argument == "--min-severity" && has_value)
+        {
+            const auto severity = parse_severity(argv[++i]);
+            if (!severity)
+                return EXIT_FAILURE;
+
+            const auto below         = static_cast<std::uint8_t>(isc::query::Query::bit(*severity) - 1);
+            options.query.severities = (severities_given ? options.query.severities : isc::query::Query::all_severities) & ~below;
+            severities_given         = true;
+        }
+        else if (argument == "--code" && has_value)
+            options.query.codes.push_back(static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10)));
+        else if (argument == "--contains" && has_value)
+        {
+            if (*argv[++i] != '\0')
+                options.query.substrings.emplace_back(argv[i]);
+        }
+        else if (argument == "--threads" && has_value)
+            options.threads = std::max(static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10)), 1u);
+        else if (argument == "--isa" && has_value)
+        {
+            const auto isa = isc::query::Search::parse_isa(argv[++i]);
+            if (!isa)
+            {
+                std::fprintf(stderr, "Unknown instruction set: %s\n", argv[i]);
+                return EXIT_FAILURE;
+            }
+
+            isc::query::Search::set_isa(*isa);
+        }
+        else if (argument == "--count")
+            options.count = true;
+        else if (argument == "--build-index")
+            options.build_index = true;
+        else if (argument == "--no-index")
+            options.use_index = false;
+        else if (argument == "--help" || argument == "-h")
+        {
+            print_usage(argv[0]);
+            return EXIT_SUCCESS;
+        }
+        else if (argument.starts_with("--"))
+        {
+            std::fprintf(stderr, "Unknown option, or missing value: %s\n", argv[i]);
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        else
+            logs.emplace_back(argument);
+    }
+
+    if (logs.empty())
+    {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    int result = EXIT_SUCCESS;
+    for (const std::string& path : logs)
+    {
+        const isc::query::MappedFile file(path);
+        if (!file.is_open())
+        {
+            std::fprintf(stderr, "Could not read log: %s\n", path.c_str());
+            result = EXIT_FAILURE;
+            continue;
+        }
+
+        if (options.build_index)
+        {
+            if (!build_index(path, file.text(), options))
+                result = EXIT_FAILURE;
+            continue;
+        }
+
+        print(path, query(path, file, options), options, logs.size() > 1);
+    }
+
+    return result;
+}